@@ -0,0 +1,350 @@
+#include "DeviceEvents.h"
+
+DeviceEventDispatcher m_deviceEvents;
+PropertyChangeWorker m_propertyWorker;
+
+static int64_t _nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+DeviceEventQueue::DeviceEventQueue()
+    : m_cells(new Cell[DEVICE_EVENT_QUEUE])
+    , m_head(0)
+    , m_tail(0)
+{
+    for(size_t i = 0; i < DEVICE_EVENT_QUEUE; i++) m_cells[i].seq.store(i, std::memory_order_relaxed);
+}
+
+bool DeviceEventQueue::push(const DeviceEvent& event)
+{
+    Cell* cell;
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    for(;;) {
+        cell = &m_cells[pos & (DEVICE_EVENT_QUEUE - 1)];
+        size_t seq = cell->seq.load(std::memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if(diff == 0) {
+            // the cell is free, claim it
+            if(m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if(diff < 0) {
+            return false;   // still holds an event from the last round
+        } else {
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event = event;
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool DeviceEventQueue::pop(DeviceEvent* event)
+{
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    Cell* cell = &m_cells[pos & (DEVICE_EVENT_QUEUE - 1)];
+    size_t seq = cell->seq.load(std::memory_order_acquire);
+    if((intptr_t)seq - (intptr_t)(pos + 1) < 0) return false;
+
+    *event = cell->event;
+    // free for the producer one round later
+    cell->seq.store(pos + DEVICE_EVENT_QUEUE, std::memory_order_release);
+    m_tail.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+size_t DeviceEventQueue::size() const
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    return head > tail ? head - tail : 0;
+}
+
+DeviceEventDispatcher::DeviceEventDispatcher()
+    : m_running(false)
+    , m_sleeping(false)
+    , m_resync(false)
+    , m_lvResync(false)
+    , m_overflowing(false)
+    , m_events(0)
+    , m_dropped(0)
+    , m_overflowed(0)
+    , m_resyncs(0)
+    , m_batches(0)
+    , m_maxDepth(0)
+{
+}
+
+DeviceEventDispatcher::~DeviceEventDispatcher()
+{
+    stop();
+}
+
+void DeviceEventDispatcher::start(Handler handler)
+{
+    if(m_running) return;
+    m_handler = handler;
+    m_running = true;
+    m_thread = std::thread([this] { run(); });
+}
+
+void DeviceEventDispatcher::stop()
+{
+    if(!m_running) return;
+    m_running = false;
+    wake();
+    if(m_thread.joinable()) m_thread.join();
+}
+
+void DeviceEventDispatcher::wake()
+{
+    // pairs with the fence in run(): either the dispatcher sees the event
+    // before it sleeps, or this sees it sleeping
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_sleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cond.notify_one();
+    }
+}
+
+// nothing later makes up for losing one of these
+static bool _mustKeep(CrInt32u type)
+{
+    return type == DeviceEvent_Connected || type == DeviceEvent_Disconnected
+        || type == DeviceEvent_Error || type == DeviceEvent_WarningExt;
+}
+
+void DeviceEventDispatcher::push(DeviceEvent& event)
+{
+    event.pushed = _nowNs();
+    bool keep = _mustKeep(event.type);
+    // while some are kept aside the next ones line up behind them
+    if(!(keep && m_overflowing.load(std::memory_order_acquire)) && m_queue.push(event)) {
+        m_events++;
+    } else if(keep) {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_overflow.push_back({ event, m_queue.head() });
+        m_overflowing.store(true, std::memory_order_release);
+        m_overflowed++;
+        m_events++;
+    } else {
+        m_dropped++;
+        // a lost change can only be made up for by reading everything again
+        if(event.type == DeviceEvent_PropertyChanged) m_resync = true;
+        else if(event.type == DeviceEvent_LvPropertyChanged) m_lvResync = true;
+        else return;
+        wake();
+        return;
+    }
+
+    size_t depth = m_queue.size();
+    size_t max = m_maxDepth.load(std::memory_order_relaxed);
+    while(depth > max && !m_maxDepth.compare_exchange_weak(max, depth, std::memory_order_relaxed));
+    wake();
+}
+
+void DeviceEventDispatcher::push(CrInt32u type, CrInt32u value)
+{
+    DeviceEvent event;
+    event.type = type;
+    event.value = value;
+    event.param1 = event.param2 = event.param3 = 0;
+    event.num = 0;
+    push(event);
+}
+
+void DeviceEventDispatcher::pushCodes(CrInt32u type, CrInt32u num, const CrInt32u* codes)
+{
+    DeviceEvent event;
+    event.type = type;
+    event.value = 0;
+    event.param1 = event.param2 = event.param3 = 0;
+    do {
+        event.num = num < DEVICE_EVENT_CODES ? num : DEVICE_EVENT_CODES;
+        for(CrInt32u i = 0; i < event.num; i++) event.codes[i] = codes[i];
+        push(event);
+        codes += event.num;
+        num -= event.num;
+    } while(num);
+}
+
+void DeviceEventDispatcher::run()
+{
+    std::vector<DeviceEvent> batch;
+    DeviceEvent event;
+
+    batch.reserve(DEVICE_EVENT_QUEUE);
+    for(;;) {
+        batch.clear();
+        if(m_resync.exchange(false)) {
+            event.type = DeviceEvent_Resync;
+            event.num = 0;
+            event.pushed = _nowNs();
+            batch.push_back(event);
+            m_resyncs++;
+        }
+        if(m_lvResync.exchange(false)) {
+            event.type = DeviceEvent_LvPropertyChanged;
+            event.num = 0;
+            event.pushed = _nowNs();
+            batch.push_back(event);
+        }
+        // only this thread pops, the popped events sit at ring positions
+        // from..tail in the batch from first on
+        size_t first = batch.size();
+        size_t from = m_queue.tail();
+        for(size_t popped = 0; popped < DEVICE_EVENT_QUEUE && m_queue.pop(&event); popped++) batch.push_back(event);
+        // kept aside when the queue was full, each goes right behind the
+        // events queued before it, ahead of those queued after
+        if(m_overflowing.load(std::memory_order_acquire)) {
+            size_t tail = m_queue.tail();
+            size_t n = 0;
+            std::lock_guard<std::mutex> lock(m_overflowMutex);
+            for(; n < m_overflow.size() && m_overflow[n].after <= tail; n++) {
+                size_t at = m_overflow[n].after > from ? m_overflow[n].after - from : 0;
+                batch.insert(batch.begin() + first + at + n, m_overflow[n].event);
+            }
+            m_overflow.erase(m_overflow.begin(), m_overflow.begin() + n);
+            m_overflowing.store(!m_overflow.empty(), std::memory_order_release);
+        }
+
+        if(!batch.empty()) {
+            int64_t now = _nowNs();
+            for(DeviceEvent& ev : batch) queued.record(now - ev.pushed);
+            m_batches++;
+            m_handler(batch);
+            continue;
+        }
+        if(!m_running && !m_overflowing) break;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_sleeping.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(!m_queue.size() && !m_resync && !m_lvResync && !m_overflowing && m_running) {
+            // woken by wake(), the timeout is only a safety net
+            m_cond.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        m_sleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+PropertyChangeWorker::PropertyChangeWorker()
+    : m_pending(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_resync(false)
+    , m_running(false)
+    , m_merged(0)
+{
+}
+
+PropertyChangeWorker::~PropertyChangeWorker()
+{
+    stop();
+}
+
+void PropertyChangeWorker::start(Handler handler)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_running) return;
+    m_handler = handler;
+    m_running = true;
+    m_thread = std::thread([this] { run(); });
+}
+
+void PropertyChangeWorker::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_running) return;
+        m_running = false;
+    }
+    m_cond.notify_one();
+    if(m_thread.joinable()) m_thread.join();
+}
+
+void PropertyChangeWorker::changed(CrInt32u num, const CrInt32u* codes)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(CrInt32u i = 0; i < num; i++) {
+            if(codes[i] >= m_pending.size()) continue;
+            if(m_pending[codes[i]]) {
+                m_merged++;
+                continue;
+            }
+            m_pending[codes[i]] = 1;
+            m_codes.push_back(codes[i]);
+        }
+    }
+    m_cond.notify_one();
+}
+
+void PropertyChangeWorker::resync()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_resync = true;
+    }
+    m_cond.notify_one();
+}
+
+void PropertyChangeWorker::run()
+{
+    std::vector<CrInt32u> codes;
+    bool resync = false;
+
+    for(;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [&]{ return !m_running || m_resync || !m_codes.empty(); });
+            if(!m_running && !m_resync && m_codes.empty()) break;
+
+            codes.swap(m_codes);
+            m_codes.clear();
+            for(CrInt32u code : codes) m_pending[code] = 0;
+            resync = m_resync;
+            m_resync = false;
+        }
+        // a resync refreshes everything anyway
+        if(resync) codes.clear();
+        m_handler(codes, resync);
+    }
+}
+
+DeviceEventStats DeviceEventDispatcher::stats()
+{
+    DeviceEventStats stats;
+    stats.events = m_events;
+    stats.dropped = m_dropped;
+    stats.overflowed = m_overflowed;
+    stats.resyncs = m_resyncs;
+    stats.batches = m_batches;
+    stats.maxDepth = m_maxDepth;
+    return stats;
+}
+
+void writeDeviceEventMetrics(std::string& out)
+{
+    static const char* const labels[DeviceEvent_Count] = {
+        "callback=\"connected\"",
+        "callback=\"disconnected\"",
+        "callback=\"error\"",
+        "callback=\"warning\"",
+        "callback=\"warning_ext\"",
+        "callback=\"property_changed\"",
+        "callback=\"lv_property_changed\"",
+        "callback=\"monitor_updated\"",
+        nullptr,
+    };
+    DeviceEventStats stats = m_deviceEvents.stats();
+
+    for(int i = 0; i < DeviceEvent_Count; i++) {
+        if(labels[i] && m_deviceEvents.dwell[i].count()) m_deviceEvents.dwell[i].write(out, "sdk_callback_dwell_ns", labels[i]);
+    }
+    m_deviceEvents.queued.write(out, "sdk_event_queued_ns");
+    metricsLine(out, "sdk_events_total", stats.events);
+    metricsLine(out, "sdk_events_dropped_total", stats.dropped);
+    metricsLine(out, "sdk_events_overflowed_total", stats.overflowed);
+    metricsLine(out, "sdk_event_resyncs_total", stats.resyncs);
+    metricsLine(out, "sdk_event_batches_total", stats.batches);
+    metricsLine(out, "sdk_event_queue_max", (uint64_t)stats.maxDepth);
+    metricsLine(out, "sdk_property_changes_merged_total", m_propertyWorker.merged());
+}
@@ -0,0 +1,213 @@
+/* hand-off of sdk callbacks to a dispatcher thread */
+
+#ifndef DEVICEEVENTS_H
+#define DEVICEEVENTS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "Metrics.h"
+
+#define DEVICE_EVENT_QUEUE 1024     // events, power of two
+#define DEVICE_EVENT_CODES 32       // codes per event, a longer list is split
+
+enum DeviceEventType
+{
+    DeviceEvent_Connected,
+    DeviceEvent_Disconnected,       // value: error
+    DeviceEvent_Error,              // value: error
+    DeviceEvent_Warning,            // value: warning
+    DeviceEvent_WarningExt,         // value: warning, param1..3
+    DeviceEvent_PropertyChanged,    // codes
+    DeviceEvent_LvPropertyChanged,  // codes, none when some were dropped
+    DeviceEvent_MonitorUpdated,     // value: frameNo, param1: CrMonitorUpdated type
+    DeviceEvent_Resync,             // property events were dropped, everything may have changed
+    DeviceEvent_Count
+};
+
+// A copy of everything a callback got, no pointers into sdk memory.
+struct DeviceEvent
+{
+    CrInt32u type;      // DeviceEventType
+    CrInt32u value;
+    CrInt32 param1;
+    CrInt32 param2;
+    CrInt32 param3;
+    CrInt32u num;
+    CrInt32u codes[DEVICE_EVENT_CODES];
+    int64_t pushed;     // steady_clock ns
+};
+
+// Bounded multi-producer single-consumer ring. Every cell carries a sequence
+// number that tells producers it is free and the consumer that it is filled,
+// so push and pop are a CAS and two atomic stores, never a lock.
+class DeviceEventQueue
+{
+public:
+    DeviceEventQueue();
+
+    // false when full
+    bool push(const DeviceEvent& event);
+    // consumer only, false when empty
+    bool pop(DeviceEvent* event);
+    size_t size() const;
+    // positions: events claimed so far, and popped so far
+    size_t head() const { return m_head.load(std::memory_order_acquire); }
+    size_t tail() const { return m_tail.load(std::memory_order_acquire); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> seq;
+        DeviceEvent event;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    alignas(64) std::atomic<size_t> m_head;     // next push
+    alignas(64) std::atomic<size_t> m_tail;     // next pop
+};
+
+struct DeviceEventStats
+{
+    uint64_t events;
+    uint64_t dropped;
+    uint64_t overflowed;    // kept aside while the queue was full
+    uint64_t resyncs;
+    uint64_t batches;
+    size_t maxDepth;
+};
+
+// The sdk callbacks only copy their arguments into a DeviceEvent and push it.
+// One thread drains the queue in batches and hands them to the handler, so a
+// slow consumer never holds up the sdk's delivery thread.
+//
+// When the queue is full only events that can be made up for are dropped:
+// a lost property change turns into a Resync, lost live view property
+// changes into one LvPropertyChanged without codes, and frame and warning
+// notifications are superseded by the next ones. Connection events and
+// WarningExt, which resolves PTZ moves, go to an overflow list behind a
+// mutex instead and are handed over once every event queued before them is.
+class DeviceEventDispatcher
+{
+public:
+    typedef std::function<void(std::vector<DeviceEvent>& events)> Handler;
+
+    DeviceEventDispatcher();
+    ~DeviceEventDispatcher();
+
+    void start(Handler handler);
+    // handles what is still queued, then joins
+    void stop();
+
+    // from sdk callback threads
+    void push(DeviceEvent& event);
+    void push(CrInt32u type, CrInt32u value = 0);
+    // split into events of DEVICE_EVENT_CODES codes
+    void pushCodes(CrInt32u type, CrInt32u num, const CrInt32u* codes);
+
+    DeviceEventStats stats();
+    // time spent inside each sdk callback, by DeviceEventType
+    LatencyHistogram dwell[DeviceEvent_Count];
+    // push to handler
+    LatencyHistogram queued;
+
+private:
+    void run();
+    void wake();
+
+    DeviceEventQueue m_queue;
+    Handler m_handler;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+
+    // the dispatcher only sleeps on these, producers take the mutex to wake
+    // it and only when it announced it is about to sleep
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::atomic<bool> m_sleeping;
+
+    std::atomic<bool> m_resync;
+    std::atomic<bool> m_lvResync;
+
+    struct Overflowed
+    {
+        DeviceEvent event;
+        size_t after;       // queue head when it was kept aside
+    };
+    std::mutex m_overflowMutex;
+    std::vector<Overflowed> m_overflow;
+    std::atomic<bool> m_overflowing;    // m_overflow is not empty, later events must queue behind it
+
+    std::atomic<uint64_t> m_events;
+    std::atomic<uint64_t> m_dropped;
+    std::atomic<uint64_t> m_overflowed;
+    std::atomic<uint64_t> m_resyncs;
+    std::atomic<uint64_t> m_batches;
+    std::atomic<size_t> m_maxDepth;
+};
+
+extern DeviceEventDispatcher m_deviceEvents;
+
+// Takes changed property codes from the dispatcher and refreshes them on its
+// own thread, so a camera round trip never holds up the frames queued behind
+// it. Codes that change again while the handler runs are merged into its next
+// call.
+class PropertyChangeWorker
+{
+public:
+    // resync: every property may have changed, codes is empty
+    typedef std::function<void(std::vector<CrInt32u>& codes, bool resync)> Handler;
+
+    PropertyChangeWorker();
+    ~PropertyChangeWorker();
+
+    void start(Handler handler);
+    // handles what is still pending, then joins
+    void stop();
+
+    void changed(CrInt32u num, const CrInt32u* codes);
+    void resync();
+
+    uint64_t merged() const { return m_merged; }
+
+private:
+    void run();
+
+    Handler m_handler;
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::vector<CrInt8u> m_pending;     // by code
+    std::vector<CrInt32u> m_codes;
+    bool m_resync;
+    bool m_running;
+    std::atomic<uint64_t> m_merged;     // changes folded into a pending refresh
+};
+
+extern PropertyChangeWorker m_propertyWorker;
+
+// time from construction to the end of the scope into m_deviceEvents.dwell
+class CallbackDwell
+{
+public:
+    CallbackDwell(CrInt32u type) : m_type(type), m_begin(std::chrono::steady_clock::now()) {}
+    ~CallbackDwell() { m_deviceEvents.dwell[m_type].record(m_begin, std::chrono::steady_clock::now()); }
+
+private:
+    CrInt32u m_type;
+    std::chrono::steady_clock::time_point m_begin;
+};
+
+// sdk_* lines for /metrics
+void writeDeviceEventMetrics(std::string& out);
+
+#endif // DEVICEEVENTS_H
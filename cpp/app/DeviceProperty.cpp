@@ -0,0 +1,441 @@
+#include "DeviceProperty.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+
+#include "Metrics.h"
+#include "RemoteCli.h"
+
+struct PropertyCompletion;
+
+// one outstanding set, resolved by the next change event for its code
+struct PropertyWaiter
+{
+    CrInt32u code;
+    SCRSDK::CrError err;    // CrError_Connect_TimeOut until resolved
+    PropertyCompletion* completion;
+};
+
+// shared by the waiters of one call
+struct PropertyCompletion
+{
+    int pending;
+    std::condition_variable cond;
+};
+
+// code -> waiters, indexed like the property cache.
+// Any number of sets may be in flight, each with its own completion.
+static std::mutex m_waitMutex;
+static std::vector<std::vector<PropertyWaiter*>> m_waiters(SCRSDK::CrDeviceProperty_MaxVal);
+// Sets of a code that were sent and whose change event has not come yet,
+// so the cached current value may be about to change and must not
+// short-circuit a set. Holds until when, so sets whose event never comes
+// stop counting PROPERTY_SET_GRACE ms after the last one's timeout.
+struct PendingSets
+{
+    int open;
+    std::chrono::steady_clock::time_point until;
+};
+static std::vector<PendingSets> m_pending(SCRSDK::CrDeviceProperty_MaxVal);
+
+// set to acknowledge by code, allocated on the first set of a code
+struct PropertySetCounters
+{
+    LatencyHistogram ack;       // SetDeviceProperty to OnPropertyChangedCodes
+    std::atomic<uint64_t> sets;
+    std::atomic<uint64_t> timeouts;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> late;     // change events after the timeout, not in ack
+    // with m_waitMutex held, sentAt is zero when no set is open. An open set
+    // expires PROPERTY_SET_GRACE after timeoutAt, a change event after that
+    // is taken for one of the camera's own.
+    std::chrono::steady_clock::time_point sentAt;
+    std::chrono::steady_clock::time_point timeoutAt;
+    PropertySetCounters() : sets(0), timeouts(0), errors(0), late(0) {}
+};
+static std::vector<std::unique_ptr<PropertySetCounters>> m_setCounters(SCRSDK::CrDeviceProperty_MaxVal);
+
+static std::atomic<uint64_t> m_setReads(0);         // state read from the camera before a set
+static std::atomic<uint64_t> m_setReadsAvoided(0);  // state served from the cache
+static std::atomic<uint64_t> m_setSkipped(0);       // already current, nothing sent
+
+// with m_waitMutex held
+static void _resolveWaiter(PropertyWaiter* waiter, SCRSDK::CrError err)
+{
+    waiter->err = err;
+    if(--waiter->completion->pending <= 0) waiter->completion->cond.notify_all();
+}
+
+// with m_waitMutex held
+static void _removeWaiter(PropertyWaiter* waiter)
+{
+    std::vector<PropertyWaiter*>& list = m_waiters[waiter->code];
+    list.erase(std::remove(list.begin(), list.end(), waiter), list.end());
+}
+
+// with m_waitMutex held
+static PropertySetCounters* _setCounters(CrInt32u code)
+{
+    if(!m_setCounters[code]) m_setCounters[code].reset(new PropertySetCounters());
+    return m_setCounters[code].get();
+}
+
+// Stamps the set of code as sent, its change event closes it. A later set of
+// the same code before the event restarts the clock.
+static void _setSent(CrInt32u code, int timeout_ms)
+{
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    if(code >= m_setCounters.size()) return;
+    PropertySetCounters* counters = _setCounters(code);
+    counters->sets++;
+    counters->sentAt = std::chrono::steady_clock::now();
+    counters->timeoutAt = counters->sentAt + std::chrono::milliseconds(timeout_ms);
+}
+
+static void _setFailed(CrInt32u code, SCRSDK::CrError err)
+{
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    if(code >= m_setCounters.size()) return;
+    PropertySetCounters* counters = _setCounters(code);
+    if(err == SCRSDK::CrError_Connect_TimeOut) {
+        // still open for the grace period, an event in it counts as late
+        counters->timeouts++;
+        counters->timeoutAt = std::chrono::steady_clock::now();
+    } else {
+        counters->errors++;
+        counters->sentAt = std::chrono::steady_clock::time_point();
+    }
+}
+
+static std::chrono::steady_clock::time_point _pendingUntil(int timeout_ms)
+{
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms + PROPERTY_SET_GRACE);
+}
+
+static bool _isPending(CrInt32u code)
+{
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    return code < m_pending.size() && m_pending[code].open > 0 && std::chrono::steady_clock::now() < m_pending[code].until;
+}
+
+// with m_waitMutex held
+static void _addPending(CrInt32u code, std::chrono::steady_clock::time_point until)
+{
+    PendingSets& pending = m_pending[code];
+    // the ones before have expired
+    if(std::chrono::steady_clock::now() >= pending.until) pending.open = 0;
+    pending.open++;
+    pending.until = std::max(pending.until, until);
+}
+
+// with m_waitMutex held, a set that was never sent; the others stay open
+static void _failPending(CrInt32u code)
+{
+    PendingSets& pending = m_pending[code];
+    if(pending.open > 0 && --pending.open == 0) pending = PendingSets();
+}
+
+// The state a set is checked against, from the cache. Only codes missing
+// there or gone stale are read from the camera, all in one request.
+// entries[i].valid is false for a code the camera does not have.
+static SCRSDK::CrError _getSetState(int64_t device_handle, const std::vector<CrInt32u>& codes, std::vector<PropertyEntry>* entries)
+{
+    std::vector<CrInt32u> missing;
+
+    entries->assign(codes.size(), PropertyEntry());
+    for(size_t i = 0; i < codes.size(); i++) {
+        if(!m_propCache.get(codes[i], &entries->at(i))) missing.push_back(codes[i]);
+    }
+    if(missing.empty()) {
+        m_setReadsAvoided++;
+        return 0;
+    }
+
+    m_setReads++;
+    SCRSDK::CrError err = m_propCache.refresh(device_handle, (CrInt32u)missing.size(), missing.data());
+    if(err) return err;
+    for(size_t i = 0; i < codes.size(); i++) {
+        if(entries->at(i).valid) continue;
+        if(!m_propCache.get(codes[i], &entries->at(i))) entries->at(i).code = codes[i];
+    }
+    return 0;
+}
+
+// Checks a set against the state from _getSetState, for both the blocking
+// and the non-blocking set. CrError_Generic_InvalidParameter when the value
+// is not a possible one; 0 with skip when the camera already has it and no
+// other set of the code is open.
+static SCRSDK::CrError _checkSet(const PropertyEntry& entry, CrInt64u value, bool* skip)
+{
+    *skip = false;
+    if(!entry.valid || entry.code >= m_waiters.size()) return SCRSDK::CrError_Generic_NotSupported;
+    if(entry.valueType == SCRSDK::CrDataType_STR) return SCRSDK::CrError_Generic_NotSupported;
+    if(!entry.setEnable) return SCRSDK::CrError_Generic_NotSupported;
+    // checked against the cached possible values, no need to ask the camera
+    if(!m_propCache.isAllowed(entry.code, value)) return SCRSDK::CrError_Generic_InvalidParameter;
+    if(entry.current == value && !_isPending(entry.code)) {
+        *skip = true;
+        m_setSkipped++;
+    }
+    return 0;
+}
+
+// Sends a set that passed _checkSet and was added as pending. When the
+// camera refuses it nothing was sent and no change event will close it.
+static SCRSDK::CrError _sendSet(int64_t device_handle, const PropertyEntry& entry, CrInt64u value, int timeout_ms)
+{
+    SCRSDK::CrDeviceProperty devProp;
+
+    devProp.SetCode(entry.code);
+    devProp.SetValueType((SCRSDK::CrDataType)entry.valueType);
+    devProp.SetCurrentValue(value);
+    _setSent(entry.code, timeout_ms);
+    SCRSDK::CrError err = SCRSDK::SetDeviceProperty(device_handle, &devProp);
+    if(err) {
+        _setFailed(entry.code, err);
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        _failPending(entry.code);
+    }
+    return err;
+}
+
+SCRSDK::CrError _getDeviceProperty(int64_t device_handle, uint32_t code, SCRSDK::CrDeviceProperty* devProp)
+{
+    std::int32_t nprop = 0;
+    SCRSDK::CrDeviceProperty* prop_list = nullptr;
+    SCRSDK::CrError err = SCRSDK::GetSelectDeviceProperties(device_handle, 1, &code, &prop_list, &nprop);
+    if(err) GotoError("", err);
+    if(prop_list && nprop >= 1) {
+        *devProp = prop_list[0];
+    }
+Error:
+    if(prop_list) SCRSDK::ReleaseDeviceProperties(device_handle, prop_list);
+    return err;
+}
+
+SCRSDK::CrError _getCachedProperty(int64_t device_handle, uint32_t code, PropertyEntry* entry)
+{
+    if(m_propCache.get(code, entry)) return 0;
+
+    SCRSDK::CrError err = m_propCache.refresh(device_handle, 1, &code);
+    if(err) return err;
+    if(!m_propCache.get(code, entry)) return SCRSDK::CrError_Generic_NotSupported;
+    return 0;
+}
+
+SCRSDK::CrError _getDeviceProperties(int64_t device_handle, const std::vector<CrInt32u>& codes, std::vector<PropertyEntry>* entries)
+{
+    SCRSDK::CrError err = m_propCache.refresh(device_handle, (CrInt32u)codes.size(), codes.data());
+    if(err) return err;
+
+    entries->resize(codes.size());
+    for(size_t i = 0; i < codes.size(); i++) {
+        if(!m_propCache.get(codes[i], &entries->at(i))) {
+            entries->at(i) = PropertyEntry();
+            entries->at(i).code = codes[i];
+        }
+    }
+    return 0;
+}
+
+SCRSDK::CrError _setDeviceProperty(int64_t device_handle, uint32_t code, uint64_t data, bool blocking, int timeout_ms)
+{
+    int result = SCRSDK::CrError_Generic_Unknown;
+    SCRSDK::CrError err = 0;
+    std::vector<PropertyResult> results;
+
+    if(!blocking) {
+        std::vector<PropertyEntry> entries;
+        bool skip = false;
+
+        err = _getSetState(device_handle, { code }, &entries);
+        if(err) GotoError("", err);
+        entries[0].code = code;
+        err = _checkSet(entries[0], data, &skip);
+        if(err == SCRSDK::CrError_Generic_InvalidParameter) GotoError("not a possible value", 0);
+        if(err) GotoError("not supported", 0);
+        if(skip) return 0;
+
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            _addPending(code, _pendingUntil(timeout_ms));
+        }
+        err = _sendSet(device_handle, entries[0], data, timeout_ms);
+        if(err) {
+            m_propCache.invalidate(1, &code);
+            GotoError("", err);
+        }
+        return 0;
+    }
+
+    err = _setDeviceProperties(device_handle, { { code, data } }, &results, timeout_ms);
+    if(results[0].skipped) {
+        std::cout << "skipped\n";
+        return 0;
+    }
+    if(err == SCRSDK::CrError_Connect_TimeOut) GotoError("timeout", 0);
+    if(err == SCRSDK::CrError_Generic_InvalidParameter) GotoError("not a possible value", 0);
+    if(err) GotoError("", err);
+    std::cout << "OK\n";
+
+    result = 0;
+Error:
+    return result;
+}
+
+SCRSDK::CrError _setDeviceProperties(int64_t device_handle, const std::vector<PropertyValue>& values, std::vector<PropertyResult>* results, int timeout_ms)
+{
+    SCRSDK::CrError result = 0;
+    SCRSDK::CrError err = 0;
+    std::vector<CrInt32u> codes;
+    std::vector<PropertyEntry> entries;
+    std::vector<PropertyWaiter> waiters;
+    std::vector<size_t> sent;   // waiter -> index in values
+    PropertyCompletion completion;
+
+    results->resize(values.size());
+    for(size_t i = 0; i < values.size(); i++) {
+        codes.push_back(values[i].code);
+        results->at(i).code = values[i].code;
+        results->at(i).err = 0;
+        results->at(i).skipped = false;
+    }
+
+    err = _getSetState(device_handle, codes, &entries);
+    if(err) {
+        for(PropertyResult& res : *results) res.err = err;
+        GotoError("", err);
+    }
+
+    waiters.reserve(values.size());
+    for(size_t i = 0; i < values.size(); i++) {
+        PropertyResult& res = results->at(i);
+        entries[i].code = values[i].code;
+        res.err = _checkSet(entries[i], values[i].value, &res.skipped);
+        if(!res.err && !res.skipped) {
+            waiters.push_back({ values[i].code, SCRSDK::CrError_Connect_TimeOut, &completion });
+            sent.push_back(i);
+        }
+    }
+
+    // registered before the first set, the events may come back at once
+    {
+        std::chrono::steady_clock::time_point until = _pendingUntil(timeout_ms);
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        completion.pending = (int)waiters.size();
+        for(PropertyWaiter& waiter : waiters) {
+            m_waiters[waiter.code].push_back(&waiter);
+            _addPending(waiter.code, until);
+        }
+    }
+
+    for(size_t w = 0; w < waiters.size(); w++) {
+        err = _sendSet(device_handle, entries[sent[w]], values[sent[w]].value, timeout_ms);
+        if(err) {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            if(waiters[w].err == SCRSDK::CrError_Connect_TimeOut) {
+                _removeWaiter(&waiters[w]);
+                _resolveWaiter(&waiters[w], err);
+            }
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        completion.cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&]{ return completion.pending <= 0; });
+        // the ones still registered timed out
+        for(PropertyWaiter& waiter : waiters) {
+            if(waiter.err == SCRSDK::CrError_Connect_TimeOut) _removeWaiter(&waiter);
+        }
+    }
+    for(size_t w = 0; w < waiters.size(); w++) {
+        results->at(sent[w]).err = waiters[w].err;
+        // without a change event nothing is known about the camera side
+        if(waiters[w].err) m_propCache.invalidate(1, &waiters[w].code);
+        if(waiters[w].err == SCRSDK::CrError_Connect_TimeOut) _setFailed(waiters[w].code, waiters[w].err);
+    }
+
+Error:
+    for(PropertyResult& res : *results) {
+        if(res.err && !result) result = res.err;
+    }
+    return result;
+}
+
+void propertyChanged(CrInt32u num, const CrInt32u* codes)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    for(CrInt32u i = 0; i < num; i++) {
+        if(codes[i] >= m_waiters.size()) continue;
+        PropertySetCounters* counters = m_setCounters[codes[i]].get();
+        if(counters && counters->sentAt.time_since_epoch().count()) {
+            if(now <= counters->timeoutAt) counters->ack.record(counters->sentAt, now);
+            else if(now <= counters->timeoutAt + std::chrono::milliseconds(PROPERTY_SET_GRACE)) counters->late++;
+            counters->sentAt = std::chrono::steady_clock::time_point();
+        }
+        for(PropertyWaiter* waiter : m_waiters[codes[i]]) _resolveWaiter(waiter, 0);
+        m_waiters[codes[i]].clear();
+        m_pending[codes[i]] = PendingSets();
+    }
+}
+
+void propertyWaitersAbort(SCRSDK::CrError err)
+{
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    for(std::vector<PropertyWaiter*>& list : m_waiters) {
+        for(PropertyWaiter* waiter : list) _resolveWaiter(waiter, err);
+        list.clear();
+    }
+    std::fill(m_pending.begin(), m_pending.end(), PendingSets());
+    for(std::unique_ptr<PropertySetCounters>& counters : m_setCounters) {
+        if(counters) counters->sentAt = std::chrono::steady_clock::time_point();
+    }
+}
+
+void getPropertySetStats(std::vector<PropertySetStats>* stats)
+{
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    stats->clear();
+    for(CrInt32u code = 0; code < m_setCounters.size(); code++) {
+        PropertySetCounters* counters = m_setCounters[code].get();
+        if(!counters) continue;
+
+        PropertySetStats stat;
+        stat.code = code;
+        stat.sets = counters->sets;
+        stat.acks = counters->ack.count();
+        stat.p50 = counters->ack.percentile(0.5);
+        stat.p99 = counters->ack.percentile(0.99);
+        stat.max = counters->ack.max();
+        stat.timeouts = counters->timeouts;
+        stat.errors = counters->errors;
+        stat.late = counters->late;
+        stats->push_back(stat);
+    }
+}
+
+void writeDevicePropertyMetrics(std::string& out)
+{
+    metricsLine(out, "prop_set_reads_total", (uint64_t)m_setReads);
+    metricsLine(out, "prop_set_reads_avoided_total", (uint64_t)m_setReadsAvoided);
+    metricsLine(out, "prop_set_skipped_total", (uint64_t)m_setSkipped);
+
+    std::lock_guard<std::mutex> lock(m_waitMutex);
+    for(CrInt32u code = 0; code < m_setCounters.size(); code++) {
+        PropertySetCounters* counters = m_setCounters[code].get();
+        if(!counters) continue;
+
+        std::string labels = "property=\"" + CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)code) + "\"";
+        if(counters->ack.count()) counters->ack.write(out, "prop_set_ack_ns", labels.c_str());
+        metricsLine(out, "prop_sets_total", (uint64_t)counters->sets, labels.c_str());
+        metricsLine(out, "prop_set_timeouts_total", (uint64_t)counters->timeouts, labels.c_str());
+        metricsLine(out, "prop_set_errors_total", (uint64_t)counters->errors, labels.c_str());
+        metricsLine(out, "prop_set_late_total", (uint64_t)counters->late, labels.c_str());
+    }
+}
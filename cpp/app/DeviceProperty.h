@@ -0,0 +1,79 @@
+/* device property get/set on top of the property cache */
+
+#ifndef DEVICEPROPERTY_H
+#define DEVICEPROPERTY_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "PropertyCache.h"
+
+#define PROPERTY_SET_GRACE 2000     // ms after its timeout a set without a change event is given up
+
+struct PropertyValue
+{
+    CrInt32u code;
+    CrInt64u value;
+};
+
+struct PropertyResult
+{
+    CrInt32u code;
+    SCRSDK::CrError err;    // CrError_Connect_TimeOut when no change event came in time
+    bool skipped;           // already current, nothing was sent
+};
+
+// set to acknowledge of one property code, times in ns
+struct PropertySetStats
+{
+    CrInt32u code;
+    uint64_t sets;          // SetDeviceProperty calls
+    uint64_t acks;          // answered by a change event
+    int64_t p50;
+    int64_t p99;
+    int64_t max;
+    uint64_t timeouts;      // blocking sets that saw no change event in time
+    uint64_t errors;        // rejected by SetDeviceProperty
+    uint64_t late;          // change events after a timeout but within PROPERTY_SET_GRACE
+};
+
+// network read of a single property
+SCRSDK::CrError _getDeviceProperty(int64_t device_handle, uint32_t code, SCRSDK::CrDeviceProperty* devProp);
+// served from the cache, a miss is fetched once and stays cached
+SCRSDK::CrError _getCachedProperty(int64_t device_handle, uint32_t code, PropertyEntry* entry);
+
+// one GetSelectDeviceProperties for all codes, the values also refresh the cache.
+// entries[i].valid is false for a code the camera did not return.
+SCRSDK::CrError _getDeviceProperties(int64_t device_handle, const std::vector<CrInt32u>& codes, std::vector<PropertyEntry>* entries);
+
+// Checks every value against the cached state (type, set enable, possible
+// values) and skips the ones already current. Only codes missing from the
+// cache or stale are read from the camera, in one request. Issues every
+// SetDeviceProperty back to back and then waits once until each code has shown
+// up in OnPropertyChangedCodes or timeout_ms has passed. A value the possible
+// values rule out is not sent and gets CrError_Generic_InvalidParameter.
+// Every code gets its own result, the return value is the first error.
+SCRSDK::CrError _setDeviceProperties(int64_t device_handle, const std::vector<PropertyValue>& values, std::vector<PropertyResult>* results, int timeout_ms = 3000);
+
+// Blocking sets wait for the change event of their own code, so any number
+// of them can be in flight from different threads. A non-blocking set
+// returns once sent, timeout_ms then only bounds how long the code counts
+// as being set.
+SCRSDK::CrError _setDeviceProperty(int64_t device_handle, uint32_t code, uint64_t data, bool blocking = true, int timeout_ms = 3000);
+
+// from OnPropertyChangedCodes, after the cache has been refreshed
+void propertyChanged(CrInt32u num, const CrInt32u* codes);
+// fails every set still waiting, e.g. on disconnect
+void propertyWaitersAbort(SCRSDK::CrError err);
+
+// every code set at least once, for the stats command
+void getPropertySetStats(std::vector<PropertySetStats>* stats);
+
+// prop_set_* lines for /metrics, pre-reads done and avoided, sets skipped
+// and the acknowledge latency, timeouts, errors and late events of every
+// code set
+void writeDevicePropertyMetrics(std::string& out);
+
+#endif // DEVICEPROPERTY_H
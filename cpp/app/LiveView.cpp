@@ -0,0 +1,367 @@
+#include "LiveView.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "RemoteCli.h"
+
+LiveViewPublisher m_liveView;
+LvLatency m_lvLatency;
+
+void LvFrameRef::reset()
+{
+    if(m_frame && --m_frame->refs == 0) m_frame->pool->release(m_frame);
+    m_frame = nullptr;
+}
+
+LvFramePool::LvFramePool(int capacity, int maxCapacity)
+    : m_frames(capacity)
+    , m_maxCapacity(maxCapacity)
+{
+    for(LvFrame& frame : m_frames) {
+        frame.pool = this;
+        m_free.push_back(&frame);
+    }
+}
+
+LvFramePool::~LvFramePool()
+{
+    for(LvFrame& frame : m_frames) delete[] frame.buffer;
+}
+
+LvFrame* LvFramePool::acquire(CrInt32u bufSize)
+{
+    LvFrame* frame = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_free.empty()) {
+            frame = m_free.back();
+            m_free.pop_back();
+        } else if(m_frames.size() < m_maxCapacity) {
+            m_frames.emplace_back();
+            frame = &m_frames.back();
+            frame->pool = this;
+        } else {
+            return nullptr;
+        }
+    }
+    if(frame->bufferSize < bufSize) {
+        delete[] frame->buffer;
+        frame->buffer = new CrInt8u[bufSize];
+        frame->bufferSize = bufSize;
+    }
+    frame->image = nullptr;
+    frame->size = 0;
+    return frame;
+}
+
+void LvFramePool::release(LvFrame* frame)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_free.push_back(frame);
+}
+
+LiveViewSession::LiveViewSession(int capacity, int maxCapacity)
+    : m_device_handle(0)
+    , m_pool(capacity, maxCapacity)
+    , m_bufSize(0)
+    , m_infoValid(false)
+    , m_propSubscribers(0)
+{
+}
+
+void LiveViewSession::open(int64_t device_handle)
+{
+    m_device_handle = device_handle;
+    m_infoValid = false;
+}
+
+SCRSDK::CrError LiveViewSession::refreshImageInfo()
+{
+    SCRSDK::CrImageInfo imageInfo;
+
+    m_infoValid = true;
+    SCRSDK::CrError err = SCRSDK::GetLiveViewImageInfo(m_device_handle, &imageInfo);
+    if(err) {
+        m_infoValid = false;
+        return err;
+    }
+    m_bufSize = imageInfo.GetBufferSize();
+    if(m_bufSize <= 0) {
+        m_infoValid = false;
+        return SCRSDK::CrError_Generic_Unknown;
+    }
+    return 0;
+}
+
+SCRSDK::CrError LiveViewSession::fetchProperties(LvFrame* frame)
+{
+    CrInt32 num = 0;
+    SCRSDK::CrLiveViewProperty* property = nullptr;
+
+    SCRSDK::CrError err = SCRSDK::GetLiveViewProperties(m_device_handle, &property, &num);
+    if(err) return err;
+    frame->properties.assign(property, property + num);
+    SCRSDK::ReleaseLiveViewProperties(m_device_handle, property);
+    return 0;
+}
+
+SCRSDK::CrError LiveViewSession::fetch(LvFrameRef* lv_frame)
+{
+    int result = SCRSDK::CrError_Generic_Unknown;
+    SCRSDK::CrError err = 0;
+    SCRSDK::CrImageDataBlock image_data;
+    LvFrame* frame = nullptr;
+
+    for(int retry = 0; retry < 2; retry++) {
+        if(!m_infoValid) {
+            err = refreshImageInfo();  if(err) GotoError("", err);
+        }
+
+        lv_frame->reset();
+        frame = m_pool.acquire(m_bufSize);
+        if (!frame) GotoError("no free frame", 0);
+        *lv_frame = LvFrameRef(frame);
+
+        image_data.SetData(frame->buffer);
+        image_data.SetSize(frame->bufferSize);
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        err = SCRSDK::GetLiveViewImage(m_device_handle, &image_data);
+        m_lvLatency.fetch.record(start, std::chrono::steady_clock::now());
+        if(err != SCRSDK::CrError_Memory_Insufficient) break;
+        // buffer size changed on the camera side
+        m_infoValid = false;
+    }
+    if(err) GotoError("", err);
+    if (image_data.GetSize() <= 0) GotoError("", 0);
+
+    frame->image = image_data.GetImageData();
+    frame->size = image_data.GetImageSize();
+    frame->frameNo = image_data.GetFrameNo();
+    frame->timeCode = image_data.GetTimeCode();
+    frame->captured = std::chrono::steady_clock::now();
+    frame->capturedWall = std::chrono::system_clock::now();
+
+    frame->properties.clear();
+    if(m_propSubscribers > 0) {
+        err = fetchProperties(frame);  if(err) GotoError("", err);
+    }
+    result = 0;
+Error:
+    if(result) lv_frame->reset();
+    return result;
+}
+
+LiveViewPublisher::LiveViewPublisher()
+    : m_session(LV_POOL_FRAMES, LV_POOL_MAX_FRAMES)
+    , m_thread(nullptr)
+    , m_running(false)
+    , m_notifySeq(0)
+    , m_viewers(0)
+    , m_demandSeq(0)
+    , m_idleGrace(LV_IDLE_GRACE)
+    , m_device_handle(0)
+    , m_lvEnabled(false)
+    , m_awaitFirstFrame(false)
+    , m_switches(0)
+    , m_firstFrameNs(0)
+    , m_frameSeq(0)
+    , m_coalesced(0)
+    , m_skipped(0)
+{
+}
+
+LiveViewPublisher::~LiveViewPublisher()
+{
+    stop();
+}
+
+void LiveViewPublisher::start(int64_t device_handle)
+{
+    if(m_thread) return;
+    m_session.open(device_handle);
+    m_device_handle = device_handle;
+    // live view is on after connecting, the grace period starts now
+    m_lvEnabled = true;
+    m_idleSince = std::chrono::steady_clock::now();
+    m_running = true;
+    m_thread = new std::thread(&LiveViewPublisher::captureLoop, this);
+}
+
+void LiveViewPublisher::stop()
+{
+    if(!m_thread) return;
+    {
+        std::lock_guard<std::mutex> lock(m_notifyMutex);
+        m_running = false;
+    }
+    m_notifyCond.notify_all();
+    m_thread->join();
+    delete m_thread;
+    m_thread = nullptr;
+}
+
+void LiveViewPublisher::notify(CrInt32u frameNo)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_notifyMutex);
+        m_notifySeq++;
+        m_notifyTime = std::chrono::steady_clock::now();
+    }
+    m_notifyCond.notify_one();
+}
+
+void LiveViewPublisher::addViewer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_notifyMutex);
+        m_viewers++;
+        m_demandSeq++;
+    }
+    m_notifyCond.notify_one();
+}
+
+void LiveViewPublisher::removeViewer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_notifyMutex);
+        if(--m_viewers == 0) m_idleSince = std::chrono::steady_clock::now();
+        m_demandSeq++;
+    }
+    m_notifyCond.notify_one();
+}
+
+LvFrameRef LiveViewPublisher::latest(uint64_t* seq)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(seq) *seq = m_frameSeq;
+    return m_latest;
+}
+
+uint64_t LiveViewPublisher::sequence()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_frameSeq;
+}
+
+bool LiveViewPublisher::waitNext(LvFrameRef& frame, uint64_t& lastSeq, int timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(!m_frameCond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&]{ return m_frameSeq > lastSeq; })) return false;
+
+    if(lastSeq && m_frameSeq - lastSeq > 1) m_skipped += m_frameSeq - lastSeq - 1;
+    lastSeq = m_frameSeq;
+    frame = m_latest;
+    return (bool)frame;
+}
+
+LvStats LiveViewPublisher::stats()
+{
+    LvStats stats;
+    {
+        std::lock_guard<std::mutex> lock(m_notifyMutex);
+        stats.notified = m_notifySeq;
+        stats.viewers = m_viewers;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        stats.captured = m_frameSeq;
+    }
+    stats.coalesced = m_coalesced;
+    stats.skipped = m_skipped;
+    m_captureRate.get(&stats.fps, nullptr);
+    stats.enabled = m_lvEnabled;
+    stats.switches = m_switches;
+    stats.firstFrameMs = m_firstFrameNs / 1e6;
+    return stats;
+}
+
+void LiveViewPublisher::publish(LvFrameRef frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_latest = frame;
+        m_frameSeq++;
+    }
+    m_frameCond.notify_all();
+    m_captureRate.update(frame->size);
+}
+
+void LiveViewPublisher::enableLiveView(bool enable)
+{
+    SCRSDK::CrError err = SCRSDK::SetDeviceSetting(m_device_handle, SCRSDK::Setting_Key_EnableLiveView,
+        enable ? SCRSDK::CrDeviceSetting_Enable : SCRSDK::CrDeviceSetting_Disable);
+    if(err) {
+        PrintError("", err);
+        // don't spin on a camera that refuses, the next pass retries
+        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+        return;
+    }
+    m_lvEnabled = enable;
+    m_switches++;
+    if(enable) {
+        // the info may have changed while live view was off
+        m_session.invalidateImageInfo();
+        m_enabledAt = std::chrono::steady_clock::now();
+        m_awaitFirstFrame = true;
+    }
+}
+
+void LiveViewPublisher::captureLoop()
+{
+    uint64_t handledSeq = 0;
+    uint64_t demandSeq = 0;
+
+    while(m_running) {
+        SCRSDK::CrError err = 0;
+        LvFrameRef frame;
+        std::chrono::steady_clock::time_point notifyTime;
+        int enable = -1;
+
+        {
+            std::unique_lock<std::mutex> lock(m_notifyMutex);
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(3000);
+            bool idle = m_viewers == 0 && m_lvEnabled && m_idleGrace >= 0;
+            if(idle) deadline = std::min(deadline, m_idleSince + std::chrono::milliseconds(m_idleGrace));
+
+            bool woken = m_notifyCond.wait_until(lock, deadline,
+                [&]{ return m_notifySeq != handledSeq || m_demandSeq != demandSeq || !m_running; });
+            if(!m_running) break;
+            demandSeq = m_demandSeq;
+
+            if(m_viewers > 0 && !m_lvEnabled) {
+                enable = 1;
+            } else if(idle && m_viewers == 0 && std::chrono::steady_clock::now() >= m_idleSince + std::chrono::milliseconds(m_idleGrace)) {
+                enable = 0;
+            } else if(m_notifySeq == handledSeq) {
+                if(!woken && !idle && m_lvEnabled) PrintError("timeout", 0);
+                continue;
+            } else if(m_viewers == 0) {
+                // nobody to fetch for, live view only stays on for the grace period
+                handledSeq = m_notifySeq;
+                continue;
+            } else {
+                // every notification since the last fetch is served by this one
+                if(handledSeq && m_notifySeq - handledSeq > 1) m_coalesced += m_notifySeq - handledSeq - 1;
+                handledSeq = m_notifySeq;
+                notifyTime = m_notifyTime;
+            }
+        }
+        if(enable >= 0) {
+            enableLiveView(enable == 1);
+            continue;
+        }
+        m_lvLatency.notify.record(notifyTime, std::chrono::steady_clock::now());
+
+        err = m_session.fetch(&frame);
+        if(err) continue;
+
+        publish(frame);
+        if(m_awaitFirstFrame) {
+            m_awaitFirstFrame = false;
+            m_firstFrameNs = std::chrono::duration_cast<std::chrono::nanoseconds>(frame->captured - m_enabledAt).count();
+            m_lvLatency.firstFrame.record(m_enabledAt, frame->captured);
+        }
+    }
+}
@@ -0,0 +1,231 @@
+/* live view capture shared by all http viewers */
+
+#ifndef LIVEVIEW_H
+#define LIVEVIEW_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "Metrics.h"
+
+// ms without viewers before live view is turned off
+#define LV_IDLE_GRACE 10000
+#define LV_IDLE_GRACE_MAX 3600000
+// ms a new viewer waits for its first frame
+#define LV_FIRST_FRAME_TIMEOUT 10000
+// http workers, so also viewers sending at the same time
+#define LV_MAX_CLIENTS 256
+// frame buffers to start with; a viewer holds its frame while it sends it,
+// so the pool may grow by one per viewer
+#define LV_POOL_FRAMES 8
+#define LV_POOL_MAX_FRAMES (LV_POOL_FRAMES + LV_MAX_CLIENTS)
+
+class LvFramePool;
+
+// pool slot; the sdk writes into buffer and image points at the jpeg inside it
+struct LvFrame
+{
+    LvFrame() : buffer(nullptr), bufferSize(0), image(nullptr), size(0), frameNo(0), timeCode(0), refs(0), pool(nullptr) {}
+
+    CrInt8u* buffer;
+    CrInt32u bufferSize;
+    const CrInt8u* image;
+    CrInt32u size;
+    CrInt32u frameNo;
+    CrInt32u timeCode;      // SMPTE 12M
+    std::chrono::steady_clock::time_point captured;
+    std::chrono::system_clock::time_point capturedWall;
+    // filled only while somebody subscribes to frame metadata
+    std::vector<SCRSDK::CrLiveViewProperty> properties;
+
+    std::atomic<int> refs;
+    LvFramePool* pool;
+};
+
+// refcounted handle, the slot goes back to its pool with the last reference
+class LvFrameRef
+{
+public:
+    LvFrameRef() : m_frame(nullptr) {}
+    explicit LvFrameRef(LvFrame* frame) : m_frame(frame) { if(m_frame) m_frame->refs++; }
+    LvFrameRef(const LvFrameRef& ref) : m_frame(ref.m_frame) { if(m_frame) m_frame->refs++; }
+    LvFrameRef(LvFrameRef&& ref) noexcept : m_frame(ref.m_frame) { ref.m_frame = nullptr; }
+    ~LvFrameRef() { reset(); }
+
+    LvFrameRef& operator =(LvFrameRef ref) { std::swap(m_frame, ref.m_frame); return *this; }
+
+    void reset();
+    const LvFrame* get() const { return m_frame; }
+    const LvFrame* operator ->() const { return m_frame; }
+    explicit operator bool() const { return m_frame != nullptr; }
+
+private:
+    LvFrame* m_frame;
+};
+
+// Frame buffers reused between frames. A buffer is reallocated only when the
+// camera reports a larger buffer size; a slot is added only when every one
+// is still referenced, up to maxCapacity.
+class LvFramePool
+{
+public:
+    LvFramePool(int capacity, int maxCapacity);
+    ~LvFramePool();
+
+    // nullptr when every slot is still referenced and the pool is full
+    LvFrame* acquire(CrInt32u bufSize);
+    void release(LvFrame* frame);
+
+private:
+    std::mutex m_mutex;
+    std::deque<LvFrame> m_frames;   // a deque keeps the slots in place as it grows
+    std::vector<LvFrame*> m_free;
+    size_t m_maxCapacity;
+};
+
+// Caches the image info between frames so a frame costs one GetLiveViewImage.
+// The info is refetched after OnLvPropertyChangedCodes or when the camera
+// reports that the buffer became too small.
+class LiveViewSession
+{
+public:
+    LiveViewSession(int capacity, int maxCapacity);
+
+    void open(int64_t device_handle);
+    void invalidateImageInfo() { m_infoValid = false; }
+
+    // while subscribed every frame also carries its live view properties
+    void subscribeProperties() { m_propSubscribers++; }
+    void unsubscribeProperties() { m_propSubscribers--; }
+
+    SCRSDK::CrError fetch(LvFrameRef* lv_frame);
+
+private:
+    SCRSDK::CrError refreshImageInfo();
+    SCRSDK::CrError fetchProperties(LvFrame* frame);
+
+    int64_t m_device_handle;
+    LvFramePool m_pool;
+    CrInt32u m_bufSize;
+    std::atomic<bool> m_infoValid;
+    std::atomic<int> m_propSubscribers;
+};
+
+// per stage latency of a frame, in ns
+struct LvLatency
+{
+    LatencyHistogram notify;    // OnNotifyMonitorUpdated -> GetLiveViewImage start
+    LatencyHistogram fetch;     // GetLiveViewImage start -> end
+    LatencyHistogram queue;     // published -> picked up by a viewer
+    LatencyHistogram write;     // sink.write start -> complete
+    LatencyHistogram firstFrame;    // live view re-enabled -> first frame published
+};
+
+extern LvLatency m_lvLatency;
+
+struct LvStats
+{
+    uint64_t notified;      // OnNotifyMonitorUpdated(LiveView) calls
+    uint64_t captured;      // frames published
+    uint64_t coalesced;     // notifications folded into a fetch that was already due
+    uint64_t skipped;       // frames a viewer never saw, it was still sending or held back by its fps limit
+    double fps;             // capture rate
+    int viewers;
+    bool enabled;           // live view on the camera side
+    uint64_t switches;      // live view on/off transitions
+    double firstFrameMs;    // last time-to-first-frame after re-enabling
+};
+
+// One capture thread fetches each frame once and publishes it to the
+// latest-frame slot. Viewers only read the slot.
+// Both directions use sequence counters instead of one-shot promises, so a
+// notification or a frame that arrives while the other side is busy is
+// never lost, only folded into the next wait.
+// Live view runs on demand: the capture thread turns it off on the camera
+// once nobody has been watching for the idle grace period, and back on
+// when the next viewer arrives. Frames are only fetched while somebody
+// watches.
+class LiveViewPublisher
+{
+public:
+    LiveViewPublisher();
+    ~LiveViewPublisher();
+
+    void start(int64_t device_handle);
+    void stop();
+
+    // from OnNotifyMonitorUpdated
+    void notify(CrInt32u frameNo);
+
+    // viewer refcount, live view is kept on while it is non-zero
+    void addViewer();
+    void removeViewer();
+    // ms without viewers before live view is turned off, <0:never
+    void setIdleGrace(int ms) { m_idleGrace = ms; }
+    int idleGrace() const { return m_idleGrace; }
+
+    LiveViewSession& session() { return m_session; }
+    LvFrameRef latest(uint64_t* seq = nullptr);
+    // frames published so far
+    uint64_t sequence();
+    // wait for a frame with sequence > lastSeq, lastSeq is updated
+    bool waitNext(LvFrameRef& frame, uint64_t& lastSeq, int timeout_ms);
+
+    LvStats stats();
+
+private:
+    void captureLoop();
+    void publish(LvFrameRef frame);
+    void enableLiveView(bool enable);
+
+    LiveViewSession m_session;
+    std::thread* m_thread;
+    std::atomic<bool> m_running;
+
+    std::mutex m_notifyMutex;
+    std::condition_variable m_notifyCond;
+    uint64_t m_notifySeq;
+    std::chrono::steady_clock::time_point m_notifyTime;
+    int m_viewers;
+    uint64_t m_demandSeq;
+    std::chrono::steady_clock::time_point m_idleSince;
+    std::atomic<int> m_idleGrace;
+
+    // capture thread only
+    int64_t m_device_handle;
+    std::atomic<bool> m_lvEnabled;
+    bool m_awaitFirstFrame;
+    std::chrono::steady_clock::time_point m_enabledAt;
+    std::atomic<uint64_t> m_switches;
+    std::atomic<int64_t> m_firstFrameNs;
+
+    std::mutex m_mutex;
+    std::condition_variable m_frameCond;
+    LvFrameRef m_latest;
+    uint64_t m_frameSeq;
+
+    std::atomic<uint64_t> m_coalesced;
+    std::atomic<uint64_t> m_skipped;
+    RateMeter m_captureRate;
+};
+
+extern LiveViewPublisher m_liveView;
+
+// holds a viewer reference for its lifetime
+class LvViewer
+{
+public:
+    LvViewer() { m_liveView.addViewer(); }
+    ~LvViewer() { m_liveView.removeViewer(); }
+    LvViewer(const LvViewer&) = delete;
+    LvViewer& operator =(const LvViewer&) = delete;
+};
+
+#endif // LIVEVIEW_H
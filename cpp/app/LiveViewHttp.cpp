@@ -0,0 +1,280 @@
+#include "LiveViewHttp.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+#include "RemoteCli.h"
+
+LvHttpConfig m_lvHttpConfig;
+
+MjpegStats m_mjpegStats;
+
+#define MJPEG_BOUNDARY "frame"
+
+static int64_t _monotonicNs(std::chrono::steady_clock::time_point tp)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+}
+
+// SMPTE 12M BCD hh:mm:ss:ff, flag bits masked
+static void _timeCodeString(CrInt32u timeCode, char* buf, size_t size)
+{
+    #define BCD(v) ((((v) >> 4) & 0xF) * 10 + ((v) & 0xF))
+    snprintf(buf, size, "%02u:%02u:%02u:%02u",
+        BCD((timeCode >> 24) & 0x3F), BCD((timeCode >> 16) & 0x7F),
+        BCD((timeCode >> 8) & 0x7F), BCD(timeCode & 0x3F));
+    #undef BCD
+}
+
+// "X-Frame-Info: <code>:<type>:<hex>,...\r\n", nothing when the frame has no properties
+static void _frameInfoHeader(const LvFrame* frame, std::string& out)
+{
+    static const char hex[] = "0123456789abcdef";
+    bool first = true;
+
+    out.clear();
+    for(const SCRSDK::CrLiveViewProperty& prop : frame->properties) {
+        char buf[32];
+        if(!prop.IsGetEnableCurrentValue()) continue;
+        snprintf(buf, sizeof(buf), "%s%x:%u:", first ? "X-Frame-Info: " : ",", prop.GetCode(), (unsigned)prop.GetFrameInfoType());
+        out += buf;
+        const CrInt8u* value = prop.GetValue();
+        for(CrInt32u i = 0; value && i < prop.GetValueSize(); i++) {
+            out += hex[value[i] >> 4];
+            out += hex[value[i] & 0xF];
+        }
+        first = false;
+    }
+    if(!first) out += "\r\n";
+}
+
+bool MjpegWriter::format(const LvFrame* frame, bool frameInfo)
+{
+    bool result = false;
+    char head[512] = {0};
+    char timeCode[16] = {0};
+    std::string info;
+
+    _timeCodeString(frame->timeCode, timeCode, sizeof(timeCode));
+    int len = snprintf(head, sizeof(head), "--" MJPEG_BOUNDARY "\r\n"
+                                           "Content-Type: image/jpeg\r\n"
+                                           "Content-Length: %u\r\n"
+                                           "X-Frame-No: %u\r\n"
+                                           "X-Timecode: %s\r\n"
+                                           "X-Capture-Monotonic-Ns: %" PRId64 "\r\n"
+                                           "X-Send-Monotonic-Ns: %" PRId64 "\r\n",
+                                           frame->size, frame->frameNo, timeCode,
+                                           _monotonicNs(frame->captured), _monotonicNs(std::chrono::steady_clock::now()));
+    if(len < 0 || (size_t)len >= sizeof(head)) GotoError("", 0);
+    if(frameInfo) _frameInfoHeader(frame, info);
+
+    m_head.assign(head, len);
+    m_head += info;
+    m_head += "\r\n";
+    result = true;
+Error:
+    return result;
+}
+
+bool MjpegWriter::write(httplib::DataSink& sink, const LvFrame* frame)
+{
+    if(!sink.write(m_head.data(), m_head.size())) return false;
+    if(!sink.write((const char*)frame->image, frame->size)) return false;
+    if(!sink.write("\r\n", 2)) return false;
+    m_mjpegStats.frames++;
+    m_mjpegStats.bytes += m_head.size() + frame->size + 2;
+    return true;
+}
+
+MjpegClient::MjpegClient(int id, const std::string& addr, int maxFps, bool frameInfo)
+    : m_id(id)
+    , m_addr(addr)
+    , m_maxFps(maxFps)
+    , m_frameInfo(frameInfo)
+    , m_lastSeq(0)
+    , m_frames(0)
+    , m_bytes(0)
+    , m_dropped(0)
+{
+    if(m_frameInfo) m_liveView.session().subscribeProperties();
+}
+
+MjpegClient::~MjpegClient()
+{
+    if(m_frameInfo) m_liveView.session().unsubscribeProperties();
+}
+
+bool MjpegClient::stream(httplib::DataSink& sink)
+{
+    bool result = false;
+    LvFrameRef frame;
+    uint64_t prevSeq = m_lastSeq;
+    uint64_t throttledFrom = 0, throttledTo = 0;
+    CrInt32u size = 0;
+
+    if(m_maxFps > 0 && m_frames) {
+        throttledFrom = std::max(m_liveView.sequence(), prevSeq);
+        std::this_thread::sleep_until(m_lastSend + std::chrono::microseconds(1000000 / m_maxFps));
+        throttledTo = m_liveView.sequence();
+    }
+
+    // the first frame may have to wait for live view to come back on
+    if(!m_liveView.waitNext(frame, m_lastSeq, m_frames ? 3000 : LV_FIRST_FRAME_TIMEOUT)) GotoError("timeout", 0);
+    // All the frames this client missed are counted by the publisher as
+    // skipped. The ones published while maxFps held it back, but for the
+    // one it takes now, are its own drops.
+    if(throttledTo > throttledFrom) {
+        m_dropped += throttledTo - throttledFrom - (m_lastSeq > throttledFrom && m_lastSeq <= throttledTo ? 1 : 0);
+    }
+
+    m_lastSend = std::chrono::steady_clock::now();
+    m_lvLatency.queue.record(frame->captured, m_lastSend);
+    if(!m_writer.format(frame.get(), m_frameInfo)) goto Error;
+    size = frame->size;
+    // sent from the pool slot, which this client holds until the write is
+    // done; the pool grows rather than run out under stalled viewers
+    if(!m_writer.write(sink, frame.get())) goto Error;
+    frame.reset();
+    m_lvLatency.write.record(m_lastSend, std::chrono::steady_clock::now());
+    m_frames++;
+    m_bytes += size;
+    m_rate.update(size);
+
+    result = true;
+Error:
+    return result;
+}
+
+MjpegClientStats MjpegClient::stats()
+{
+    MjpegClientStats stats;
+    stats.id = m_id;
+    stats.addr = m_addr;
+    stats.maxFps = m_maxFps;
+    stats.frames = m_frames;
+    stats.bytes = m_bytes;
+    stats.dropped = m_dropped;
+    m_rate.get(&stats.fps, &stats.bytesPerSec);
+    return stats;
+}
+
+static std::mutex m_clientsMutex;
+static std::vector<std::shared_ptr<MjpegClient>> m_clients;
+static int m_clientId = 0;
+
+std::vector<MjpegClientStats> getMjpegClients()
+{
+    std::vector<std::shared_ptr<MjpegClient>> clients;
+    {
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        clients = m_clients;
+    }
+    std::vector<MjpegClientStats> stats;
+    for(std::shared_ptr<MjpegClient>& client : clients) {
+        stats.push_back(client->stats());
+    }
+    return stats;
+}
+
+void writeLiveViewMetrics(std::string& out)
+{
+    LvStats lv = m_liveView.stats();
+    std::vector<MjpegClientStats> clients = getMjpegClients();
+
+    m_lvLatency.notify.write(out, "lv_stage_ns", "stage=\"notify\"");
+    m_lvLatency.fetch.write(out, "lv_stage_ns", "stage=\"fetch\"");
+    m_lvLatency.queue.write(out, "lv_stage_ns", "stage=\"queue\"");
+    m_lvLatency.write.write(out, "lv_stage_ns", "stage=\"write\"");
+    metricsLine(out, "lv_capture_fps", lv.fps);
+    metricsLine(out, "lv_notified_total", lv.notified);
+    metricsLine(out, "lv_captured_total", lv.captured);
+    metricsLine(out, "lv_coalesced_total", lv.coalesced);
+    metricsLine(out, "lv_skipped_total", lv.skipped);
+    metricsLine(out, "lv_frames_sent_total", (uint64_t)m_mjpegStats.frames);
+    metricsLine(out, "lv_bytes_sent_total", (uint64_t)m_mjpegStats.bytes);
+    metricsLine(out, "lv_clients", (uint64_t)clients.size());
+    metricsLine(out, "lv_viewers", (uint64_t)lv.viewers);
+    metricsLine(out, "lv_enabled", (uint64_t)lv.enabled);
+    metricsLine(out, "lv_switches_total", lv.switches);
+    m_lvLatency.firstFrame.write(out, "lv_first_frame_ns");
+}
+
+void handle_liveview(const httplib::Request& req, httplib::Response& res)
+{
+    int maxFps = m_lvHttpConfig.maxFps;
+    if(req.has_param("fps")) {
+        int fps = 0;
+        try { fps = std::stoi(req.get_param_value("fps")); } catch(const std::exception&) {}
+        if(fps > 0 && (maxFps <= 0 || fps < maxFps)) maxFps = fps;
+    }
+    // ?meta=1: live view properties with every frame, costs one more sdk call per frame
+    bool frameInfo = req.has_param("meta") && req.get_param_value("meta") != "0";
+
+    std::shared_ptr<MjpegClient> client;
+    {
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        client = std::make_shared<MjpegClient>(++m_clientId, req.remote_addr + ":" + std::to_string(req.remote_port), maxFps, frameInfo);
+        m_clients.push_back(client);
+    }
+
+    res.set_header("Access-Control-Allow-Origin", "*");
+    // no chunked encoding, the stream simply ends with the connection
+    res.set_header("Connection", "close");
+    res.set_content_provider(
+        "multipart/x-mixed-replace; boundary=" MJPEG_BOUNDARY,
+        [client](size_t offset, httplib::DataSink &sink) {
+            return client->stream(sink);
+        },
+        [client](bool success) {
+            std::lock_guard<std::mutex> lock(m_clientsMutex);
+            m_clients.erase(std::remove(m_clients.begin(), m_clients.end(), client), m_clients.end());
+        }
+    );
+}
+
+static std::string _httpDate(std::chrono::system_clock::time_point tp)
+{
+    time_t t = std::chrono::system_clock::to_time_t(tp);
+    struct tm tm;
+    char buf[64] = {0};
+#if defined(_WIN32) || defined(_WIN64)
+    gmtime_s(&tm, &t);
+#else
+    gmtime_r(&t, &tm);
+#endif
+    strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &tm);
+    return buf;
+}
+
+void handle_snapshot(const httplib::Request& req, httplib::Response& res)
+{
+    uint64_t lastSeq = 0;
+    LvFrameRef frame = m_liveView.latest(&lastSeq);
+
+    if(!frame || std::chrono::steady_clock::now() - frame->captured > std::chrono::milliseconds(m_lvHttpConfig.snapshotMaxAge.load())) {
+        // only a poll that needs a new frame keeps live view on, one served
+        // from the cached frame must not restart the idle grace period
+        LvViewer viewer;
+        if(!m_liveView.waitNext(frame, lastSeq, LV_FIRST_FRAME_TIMEOUT)) {
+            res.status = 503;
+            return;
+        }
+    }
+
+    char etag[32] = {0};
+    snprintf(etag, sizeof(etag), "\"%u\"", frame->frameNo);
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_header("Cache-Control", "no-cache");
+    res.set_header("ETag", etag);
+    res.set_header("Last-Modified", _httpDate(frame->capturedWall));
+    if(req.get_header_value("If-None-Match") == etag) {
+        res.status = 304;
+        return;
+    }
+
+    // copied, a slow client must not hold the pool slot through the transfer
+    res.set_content(std::string((const char*)frame->image, frame->size), "image/jpeg");
+}
@@ -0,0 +1,108 @@
+/* http endpoints serving the shared live view */
+
+#ifndef LIVEVIEWHTTP_H
+#define LIVEVIEWHTTP_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "httplib.h"
+#include "LiveView.h"
+
+#define LV_MAX_FPS 120      // highest per client limit
+#define LV_MAX_AGE 60000    // ms, highest snapshotMaxAge
+
+// set from the cli, read by the http workers
+struct LvHttpConfig
+{
+    std::atomic<int> maxFps{0};             // per client, 0:camera rate
+    std::atomic<int> snapshotMaxAge{1000};  // ms, older frames make /snapshot.jpg wait for a new one
+};
+
+extern LvHttpConfig m_lvHttpConfig;
+
+struct MjpegStats
+{
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+extern MjpegStats m_mjpegStats;
+
+// Writes one multipart/x-mixed-replace part per frame.
+// Every part carries X-Frame-No, X-Timecode and the steady_clock capture and
+// send times in ns, so viewers can measure queueing latency and gaps.
+// With frameInfo it also carries X-Frame-Info, the frame's live view
+// properties as <code>:<frame info type>:<value in hex>, comma separated.
+// Boundary and part headers are formatted into a per-connection buffer;
+// the jpeg is sent from the pool buffer it was captured into, never copied.
+// The response is sent without chunked encoding, so each of the three sink
+// writes, headers, jpeg and trailing CRLF, goes straight to send().
+class MjpegWriter
+{
+public:
+    // part headers of frame, false on error
+    bool format(const LvFrame* frame, bool frameInfo = false);
+    // sends the part, the frame must stay referenced until it returns
+    bool write(httplib::DataSink& sink, const LvFrame* frame);
+
+private:
+    std::string m_head;
+};
+
+struct MjpegClientStats
+{
+    int id;
+    std::string addr;
+    int maxFps;
+    uint64_t frames;
+    uint64_t bytes;
+    uint64_t dropped;       // frames published while held back by maxFps
+    double fps;
+    double bytesPerSec;
+};
+
+// One viewer connection. Its send queue is the publisher's latest-frame slot
+// seen through lastSeq: at most one frame is pending and a newer frame
+// replaces it, so a slow link gets fewer but current frames.
+// A client asking for frame info keeps the live view properties subscribed
+// while it is connected.
+class MjpegClient
+{
+public:
+    MjpegClient(int id, const std::string& addr, int maxFps, bool frameInfo);
+    ~MjpegClient();
+
+    // send the next frame, false ends the stream
+    bool stream(httplib::DataSink& sink);
+    MjpegClientStats stats();
+
+private:
+    LvViewer m_viewer;
+    int m_id;
+    std::string m_addr;
+    int m_maxFps;
+    bool m_frameInfo;
+    uint64_t m_lastSeq;
+    std::chrono::steady_clock::time_point m_lastSend;
+    MjpegWriter m_writer;
+
+    std::atomic<uint64_t> m_frames;
+    std::atomic<uint64_t> m_bytes;
+    std::atomic<uint64_t> m_dropped;
+    RateMeter m_rate;
+};
+
+std::vector<MjpegClientStats> getMjpegClients();
+// lv_* lines for /metrics
+void writeLiveViewMetrics(std::string& out);
+
+void handle_liveview(const httplib::Request& req, httplib::Response& res);
+void handle_snapshot(const httplib::Request& req, httplib::Response& res);
+
+#endif // LIVEVIEWHTTP_H
@@ -0,0 +1,159 @@
+#include "Metrics.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+#include "httplib.h"
+
+LatencyHistogram::LatencyHistogram()
+    : m_count(0)
+    , m_sum(0)
+    , m_max(0)
+{
+    for(int i = 0; i < BUCKETS; i++) m_buckets[i] = 0;
+}
+
+int LatencyHistogram::bucketOf(uint64_t ns)
+{
+    if(ns < SUB_COUNT) return (int)ns;
+
+    int exp = 63;
+    while(!(ns >> exp)) exp--;
+    if(exp > MAX_EXP) return BUCKETS - 1;
+    int sub = (int)((ns >> (exp - SUB_BITS)) & (SUB_COUNT - 1));
+    return (exp - SUB_BITS + 1) * SUB_COUNT + sub;
+}
+
+int64_t LatencyHistogram::bucketTop(int bucket)
+{
+    if(bucket < SUB_COUNT) return bucket;
+
+    int exp = bucket / SUB_COUNT + SUB_BITS - 1;
+    int sub = bucket % SUB_COUNT;
+    return ((int64_t)(SUB_COUNT + sub + 1) << (exp - SUB_BITS)) - 1;
+}
+
+void LatencyHistogram::record(int64_t ns)
+{
+    if(ns < 0) ns = 0;
+    m_buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(ns, std::memory_order_relaxed);
+
+    int64_t max = m_max.load(std::memory_order_relaxed);
+    while(ns > max && !m_max.compare_exchange_weak(max, ns, std::memory_order_relaxed));
+}
+
+int64_t LatencyHistogram::mean() const
+{
+    uint64_t count = this->count();
+    return count ? m_sum.load(std::memory_order_relaxed) / (int64_t)count : 0;
+}
+
+int64_t LatencyHistogram::percentile(double q) const
+{
+    uint64_t count = this->count();
+    if(!count) return 0;
+
+    uint64_t rank = (uint64_t)(q * count);
+    if(rank >= count) rank = count - 1;
+    uint64_t seen = 0;
+    for(int i = 0; i < BUCKETS; i++) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if(seen > rank) {
+            int64_t top = bucketTop(i);
+            return top < max() ? top : max();
+        }
+    }
+    return max();
+}
+
+void LatencyHistogram::write(std::string& out, const char* name, const char* labels) const
+{
+    static const char* const quantiles[] = { "0.5", "0.9", "0.99" };
+    static const double values[] = { 0.5, 0.9, 0.99 };
+    char buf[256];
+
+    for(int i = 0; i < 3; i++) {
+        snprintf(buf, sizeof(buf), "%s{%s%squantile=\"%s\"} %" PRId64 "\n",
+            name, labels ? labels : "", labels ? "," : "", quantiles[i], percentile(values[i]));
+        out += buf;
+    }
+    snprintf(buf, sizeof(buf), "%s_max%s%s%s %" PRId64 "\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", max());
+    out += buf;
+    snprintf(buf, sizeof(buf), "%s_count%s%s%s %" PRIu64 "\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", count());
+    out += buf;
+}
+
+RateMeter::RateMeter()
+    : m_start(std::chrono::steady_clock::now())
+    , m_events(0)
+    , m_bytes(0)
+    , m_perSec(0)
+    , m_bytesPerSec(0)
+{
+}
+
+void RateMeter::update(uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - m_start).count();
+
+    m_events++;
+    m_bytes += bytes;
+    if(elapsed >= 1.0) {
+        m_perSec = m_events / elapsed;
+        m_bytesPerSec = m_bytes / elapsed;
+        m_start = now;
+        m_events = 0;
+        m_bytes = 0;
+    }
+}
+
+void RateMeter::get(double* perSec, double* bytesPerSec)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // nothing for a whole window means the stream stalled
+    if(std::chrono::steady_clock::now() - m_start > std::chrono::seconds(2)) {
+        m_perSec = 0;
+        m_bytesPerSec = 0;
+    }
+    if(perSec) *perSec = m_perSec;
+    if(bytesPerSec) *bytesPerSec = m_bytesPerSec;
+}
+
+void metricsLine(std::string& out, const char* name, double value, const char* labels)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s%s%s%s %.6g\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", value);
+    out += buf;
+}
+
+void metricsLine(std::string& out, const char* name, uint64_t value, const char* labels)
+{
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s%s%s%s %" PRIu64 "\n", name, labels ? "{" : "", labels ? labels : "", labels ? "}" : "", value);
+    out += buf;
+}
+
+static std::mutex m_sourcesMutex;
+static std::vector<MetricsSource> m_sources;
+
+void addMetricsSource(MetricsSource source)
+{
+    std::lock_guard<std::mutex> lock(m_sourcesMutex);
+    m_sources.push_back(source);
+}
+
+void handle_metrics(const httplib::Request& req, httplib::Response& res)
+{
+    std::string out;
+    {
+        std::lock_guard<std::mutex> lock(m_sourcesMutex);
+        for(MetricsSource& source : m_sources) source(out);
+    }
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_content(out, "text/plain; version=0.0.4");
+}
@@ -0,0 +1,75 @@
+/* lock-free latency histograms and the text /metrics endpoint */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace httplib { struct Request; struct Response; }
+
+// HDR style log-linear buckets: 8 sub-buckets per power of two (12.5%
+// resolution) up to 2^40 ns. record() is a few relaxed atomic adds.
+class LatencyHistogram
+{
+public:
+    enum { SUB_BITS = 3, SUB_COUNT = 1 << SUB_BITS, MAX_EXP = 40, BUCKETS = (MAX_EXP + 1) * SUB_COUNT };
+
+    LatencyHistogram();
+
+    void record(int64_t ns);
+    void record(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end)
+    {
+        record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    }
+
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    int64_t max() const { return m_max.load(std::memory_order_relaxed); }
+    int64_t mean() const;
+    // upper bound of the bucket holding the q quantile, 0 <= q <= 1
+    int64_t percentile(double q) const;
+
+    // prometheus style lines: name{quantile="..."}, name_max, name_count
+    void write(std::string& out, const char* name, const char* labels = nullptr) const;
+
+private:
+    static int bucketOf(uint64_t ns);
+    static int64_t bucketTop(int bucket);
+
+    std::atomic<uint64_t> m_buckets[BUCKETS];
+    std::atomic<uint64_t> m_count;
+    std::atomic<int64_t> m_sum;
+    std::atomic<int64_t> m_max;
+};
+
+// events and bytes per second over the last complete one-second window
+class RateMeter
+{
+public:
+    RateMeter();
+
+    void update(uint64_t bytes);
+    void get(double* perSec, double* bytesPerSec);
+
+private:
+    std::mutex m_mutex;
+    std::chrono::steady_clock::time_point m_start;
+    uint64_t m_events;
+    uint64_t m_bytes;
+    double m_perSec;
+    double m_bytesPerSec;
+};
+
+void metricsLine(std::string& out, const char* name, double value, const char* labels = nullptr);
+void metricsLine(std::string& out, const char* name, uint64_t value, const char* labels = nullptr);
+
+typedef std::function<void(std::string& out)> MetricsSource;
+void addMetricsSource(MetricsSource source);
+
+void handle_metrics(const httplib::Request& req, httplib::Response& res);
+
+#endif // METRICS_H
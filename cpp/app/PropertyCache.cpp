@@ -0,0 +1,199 @@
+#include "PropertyCache.h"
+
+#include <mutex>
+
+#include "Metrics.h"
+#include "PropertyValues.h"
+#include "RemoteCli.h"
+
+PropertyCache m_propCache;
+
+PropertyCache::PropertyCache()
+    : m_entries(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_values(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_setValues(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_strings(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_count(0)
+    , m_hits(0)
+    , m_misses(0)
+    , m_refreshes(0)
+    , m_refreshed(0)
+{
+    clear();
+}
+
+void PropertyCache::clear()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for(size_t i = 0; i < m_entries.size(); i++) {
+        m_entries[i] = PropertyEntry();
+        m_entries[i].code = (CrInt32u)i;
+        m_entries[i].valid = false;
+        m_values[i].clear();
+        m_setValues[i].clear();
+        m_strings[i].clear();
+    }
+    m_count = 0;
+}
+
+void PropertyCache::store(const SCRSDK::CrDeviceProperty& prop)
+{
+    CrInt32u code = prop.GetCode();
+    if(code >= m_entries.size()) return;
+
+    PropertyEntry& entry = m_entries[code];
+    if(!entry.valid) m_count++;
+    entry.valueType = prop.GetValueType();
+    entry.current = prop.GetCurrentValue();
+    entry.enableFlag = (CrInt16u)prop.GetPropertyEnableFlag();
+    entry.variableFlag = (CrInt8u)prop.GetPropertyVariableFlag();
+    entry.getEnable = prop.IsGetEnableCurrentValue();
+    entry.setEnable = prop.IsSetEnableCurrentValue();
+    entry.valid = true;
+
+    const CrInt8u* values = prop.GetValues();
+    if(values) m_values[code].assign(values, values + prop.GetValueSize());
+    else m_values[code].clear();
+    const CrInt8u* setValues = prop.GetSetValues();
+    if(setValues) m_setValues[code].assign(setValues, setValues + prop.GetSetValueSize());
+    else m_setValues[code].clear();
+    // decoded in place, the string keeps its buffer between refreshes
+    if(entry.valueType == SCRSDK::CrDataType_STR) propertyStringToUtf8(prop.GetCurrentStr(), &m_strings[code]);
+    else m_strings[code].clear();
+}
+
+SCRSDK::CrError PropertyCache::load(int64_t device_handle)
+{
+    CrInt32 nprop = 0;
+    SCRSDK::CrDeviceProperty* prop_list = nullptr;
+
+    SCRSDK::CrError err = SCRSDK::GetDeviceProperties(device_handle, &prop_list, &nprop);
+    if(err) GotoError("", err);
+    {
+        std::vector<bool> returned(m_entries.size(), false);
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        for(CrInt32 i = 0; i < nprop; i++) {
+            store(prop_list[i]);
+            if(prop_list[i].GetCode() < returned.size()) returned[prop_list[i].GetCode()] = true;
+        }
+        // gone from the camera, e.g. after a mode change
+        for(size_t code = 0; code < m_entries.size(); code++) {
+            if(!returned[code]) drop((CrInt32u)code);
+        }
+    }
+Error:
+    if(prop_list) SCRSDK::ReleaseDeviceProperties(device_handle, prop_list);
+    return err;
+}
+
+SCRSDK::CrError PropertyCache::refresh(int64_t device_handle, CrInt32u num, const CrInt32u* codes)
+{
+    CrInt32 nprop = 0;
+    SCRSDK::CrDeviceProperty* prop_list = nullptr;
+
+    if(!num) return 0;
+    SCRSDK::CrError err = SCRSDK::GetSelectDeviceProperties(device_handle, num, const_cast<CrInt32u*>(codes), &prop_list, &nprop);
+    if(err) {
+        invalidate(num, codes);
+        GotoError("", err);
+    }
+    m_refreshes++;
+    m_refreshed += num;
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        for(CrInt32u i = 0; i < num; i++) {
+            bool returned = false;
+            for(CrInt32 j = 0; j < nprop && !returned; j++) returned = prop_list[j].GetCode() == codes[i];
+            if(!returned) drop(codes[i]);
+        }
+        for(CrInt32 i = 0; i < nprop; i++) store(prop_list[i]);
+    }
+Error:
+    if(prop_list) SCRSDK::ReleaseDeviceProperties(device_handle, prop_list);
+    return err;
+}
+
+void PropertyCache::invalidate(CrInt32u num, const CrInt32u* codes)
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for(CrInt32u i = 0; i < num; i++) drop(codes[i]);
+}
+
+void PropertyCache::drop(CrInt32u code)
+{
+    if(code >= m_entries.size() || !m_entries[code].valid) return;
+    m_entries[code].valid = false;
+    m_count--;
+}
+
+bool PropertyCache::get(CrInt32u code, PropertyEntry* entry)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        if(code < m_entries.size() && m_entries[code].valid) {
+            *entry = m_entries[code];
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void PropertyCache::codes(std::vector<CrInt32u>* codes)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    codes->clear();
+    for(const PropertyEntry& entry : m_entries) {
+        if(entry.valid) codes->push_back(entry.code);
+    }
+}
+
+bool PropertyCache::getValues(CrInt32u code, std::vector<CrInt8u>* values)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if(code >= m_entries.size() || !m_entries[code].valid) return false;
+    *values = m_values[code];
+    return true;
+}
+
+bool PropertyCache::getString(CrInt32u code, std::string* str)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if(code >= m_entries.size() || !m_entries[code].valid) return false;
+    *str = m_strings[code];
+    return true;
+}
+
+bool PropertyCache::isAllowed(CrInt32u code, CrInt64u value)
+{
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    if(code >= m_entries.size() || !m_entries[code].valid) return true;
+    const std::vector<CrInt8u>& values = m_setValues[code].empty() ? m_values[code] : m_setValues[code];
+    return propertyValueAllowed(m_entries[code].valueType, values.data(), values.size(), value);
+}
+
+PropertyCacheStats PropertyCache::stats()
+{
+    PropertyCacheStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.refreshes = m_refreshes;
+    stats.refreshed = m_refreshed;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        stats.entries = m_count;
+    }
+    return stats;
+}
+
+void writePropertyCacheMetrics(std::string& out)
+{
+    PropertyCacheStats stats = m_propCache.stats();
+
+    metricsLine(out, "prop_cache_entries", (uint64_t)stats.entries);
+    metricsLine(out, "prop_cache_hits_total", stats.hits);
+    metricsLine(out, "prop_cache_misses_total", stats.misses);
+    metricsLine(out, "prop_cache_refreshes_total", stats.refreshes);
+    metricsLine(out, "prop_cache_refreshed_codes_total", stats.refreshed);
+}
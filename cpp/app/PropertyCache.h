@@ -0,0 +1,92 @@
+/* device property cache fed by property change events */
+
+#ifndef PROPERTYCACHE_H
+#define PROPERTYCACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+
+// hot part of a cached property, one flat slot per property code
+struct PropertyEntry
+{
+    CrInt32u code;
+    CrInt32u valueType;     // SCRSDK::CrDataType
+    CrInt64u current;
+    CrInt16u enableFlag;    // SCRSDK::CrPropertyEnableFlag
+    CrInt8u variableFlag;   // SCRSDK::CrPropertyVariableFlag
+    bool getEnable;
+    bool setEnable;
+    bool valid;
+};
+
+struct PropertyCacheStats
+{
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t refreshes;     // GetSelectDeviceProperties calls
+    uint64_t refreshed;     // codes fetched by them
+    int entries;
+};
+
+// Filled with one GetDeviceProperties at connect, then kept current from
+// OnPropertyChangedCodes by refetching only the changed codes in one batch.
+// Reads are a table lookup under a shared lock, no camera round trip.
+// Possible values and strings live in separate cold tables so the hot one
+// stays small.
+class PropertyCache
+{
+public:
+    PropertyCache();
+
+    // codes the camera no longer returns are dropped
+    SCRSDK::CrError load(int64_t device_handle);
+    // a failed refresh leaves the codes stale, requested codes the camera
+    // did not return are dropped
+    SCRSDK::CrError refresh(int64_t device_handle, CrInt32u num, const CrInt32u* codes);
+    void clear();
+    // stale codes read as not cached until the next refresh
+    void invalidate(CrInt32u num, const CrInt32u* codes);
+
+    // false when the code is not cached
+    bool get(CrInt32u code, PropertyEntry* entry);
+    // every cached code
+    void codes(std::vector<CrInt32u>* codes);
+    // raw possible values as the sdk reports them, decode with valueType
+    bool getValues(CrInt32u code, std::vector<CrInt8u>* values);
+    // current value of a STR property as UTF-8
+    bool getString(CrInt32u code, std::string* str);
+    // false only when the cached possible values rule value out,
+    // see propertyValueAllowed. Uncached codes are allowed.
+    bool isAllowed(CrInt32u code, CrInt64u value);
+
+    PropertyCacheStats stats();
+
+private:
+    void store(const SCRSDK::CrDeviceProperty& prop);
+    // with m_mutex held
+    void drop(CrInt32u code);
+
+    std::shared_mutex m_mutex;
+    std::vector<PropertyEntry> m_entries;
+    std::vector<std::vector<CrInt8u>> m_values;
+    std::vector<std::vector<CrInt8u>> m_setValues;  // only when the camera sends a separate settable list
+    std::vector<std::string> m_strings;
+    int m_count;
+
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+    std::atomic<uint64_t> m_refreshes;
+    std::atomic<uint64_t> m_refreshed;
+};
+
+extern PropertyCache m_propCache;
+
+// prop_cache_* lines for /metrics
+void writePropertyCacheMetrics(std::string& out);
+
+#endif // PROPERTYCACHE_H
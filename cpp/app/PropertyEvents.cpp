@@ -0,0 +1,229 @@
+#include "PropertyEvents.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include "Metrics.h"
+#include "PropertyCache.h"
+#include "RemoteCli.h"
+
+PropertyEventConfig m_propEventConfig;
+
+static std::atomic<uint64_t> m_eventsSent(0);
+static std::atomic<uint64_t> m_eventsCoalesced(0);
+
+static void _jsonString(const std::string& str, std::string* out)
+{
+    char buf[8];
+    *out += '"';
+    for(char c : str) {
+        if(c == '"' || c == '\\') {
+            *out += '\\';
+            *out += c;
+        } else if((unsigned char)c < 0x20) {
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            *out += buf;
+        } else {
+            *out += c;
+        }
+    }
+    *out += '"';
+}
+
+PropertyEventClient::PropertyEventClient(int id, const std::string& addr, int window, const std::vector<CrInt8u>& filter)
+    : m_id(id)
+    , m_addr(addr)
+    , m_window(window)
+    , m_filter(filter)
+    , m_filterCount((int)std::count(filter.begin(), filter.end(), 1))
+    , m_dirty(SCRSDK::CrDeviceProperty_MaxVal)
+    , m_closed(false)
+    , m_events(0)
+    , m_coalesced(0)
+{
+}
+
+void PropertyEventClient::changed(CrInt32u num, const CrInt32u* codes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(CrInt32u i = 0; i < num; i++) {
+        CrInt32u code = codes[i];
+        if(code >= m_dirty.size()) continue;
+        if(!m_filter.empty() && !m_filter[code]) continue;
+        if(m_dirty[code]) {
+            m_coalesced++;
+            m_eventsCoalesced++;
+            continue;
+        }
+        if(m_changed.empty()) m_firstChange = std::chrono::steady_clock::now();
+        m_dirty[code] = 1;
+        m_changed.push_back(code);
+    }
+    if(!m_changed.empty()) m_cond.notify_one();
+}
+
+void PropertyEventClient::close()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_closed = true;
+    m_cond.notify_one();
+}
+
+bool PropertyEventClient::stream(httplib::DataSink& sink)
+{
+    static const char keepalive[] = ": keepalive\n\n";
+    std::vector<CrInt32u> codes;
+    std::chrono::steady_clock::time_point sendAt;
+    char buf[128];
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(!m_cond.wait_for(lock, std::chrono::milliseconds(PROP_EVENT_KEEPALIVE), [&]{ return m_closed || !m_changed.empty(); })) {
+            // keeps proxies from dropping an idle connection
+            return sink.write(keepalive, sizeof(keepalive) - 1);
+        }
+        if(m_closed) return false;
+        sendAt = m_firstChange + std::chrono::milliseconds(m_window);
+    }
+
+    // let the burst collect, later changes of a marked code are coalesced
+    std::this_thread::sleep_until(sendAt);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_closed) return false;
+        codes.swap(m_changed);
+        for(CrInt32u code : codes) m_dirty[code] = 0;
+    }
+
+    m_buf.clear();
+    for(CrInt32u code : codes) {
+        PropertyEntry entry;
+        if(!m_propCache.get(code, &entry)) continue;
+
+        snprintf(buf, sizeof(buf), "event: property\ndata: {\"code\":%u,\"name\":", code);
+        m_buf += buf;
+        _jsonString(CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)code), &m_buf);
+        m_buf += ",\"value\":";
+        if(entry.valueType == SCRSDK::CrDataType_STR) {
+            std::string str;
+            m_propCache.getString(code, &str);
+            _jsonString(str, &m_buf);
+        } else {
+            snprintf(buf, sizeof(buf), "%" PRId64, (int64_t)entry.current);
+            m_buf += buf;
+        }
+        m_buf += "}\n\n";
+        m_events++;
+        m_eventsSent++;
+    }
+    // the whole batch in one write
+    if(m_buf.empty()) return true;
+    return sink.write(m_buf.data(), m_buf.size());
+}
+
+PropertyEventClientStats PropertyEventClient::stats()
+{
+    PropertyEventClientStats stats;
+    stats.id = m_id;
+    stats.addr = m_addr;
+    stats.window = m_window;
+    stats.codes = m_filterCount;
+    stats.events = m_events;
+    stats.coalesced = m_coalesced;
+    return stats;
+}
+
+static std::mutex m_clientsMutex;
+static std::vector<std::shared_ptr<PropertyEventClient>> m_clients;
+static int m_clientId = 0;
+
+void propertyEventsPublish(CrInt32u num, const CrInt32u* codes)
+{
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    for(std::shared_ptr<PropertyEventClient>& client : m_clients) client->changed(num, codes);
+}
+
+void propertyEventsClose()
+{
+    std::lock_guard<std::mutex> lock(m_clientsMutex);
+    for(std::shared_ptr<PropertyEventClient>& client : m_clients) client->close();
+}
+
+std::vector<PropertyEventClientStats> getPropertyEventClients()
+{
+    std::vector<std::shared_ptr<PropertyEventClient>> clients;
+    {
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        clients = m_clients;
+    }
+    std::vector<PropertyEventClientStats> stats;
+    for(std::shared_ptr<PropertyEventClient>& client : clients) {
+        stats.push_back(client->stats());
+    }
+    return stats;
+}
+
+void writePropertyEventMetrics(std::string& out)
+{
+    size_t clients = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        clients = m_clients.size();
+    }
+    metricsLine(out, "prop_events_clients", (uint64_t)clients);
+    metricsLine(out, "prop_events_sent_total", (uint64_t)m_eventsSent);
+    metricsLine(out, "prop_events_coalesced_total", (uint64_t)m_eventsCoalesced);
+}
+
+void handle_events(const httplib::Request& req, httplib::Response& res)
+{
+    int window = m_propEventConfig.window;
+    std::vector<CrInt8u> filter;
+    std::vector<CrInt32u> codes;
+
+    if(req.has_param("window")) {
+        try { window = std::stoi(req.get_param_value("window")); } catch(const std::exception&) {}
+        // a longer wait would hold a change back past the next keepalive
+        window = std::min(std::max(window, 0), PROP_EVENT_KEEPALIVE);
+    }
+    if(req.has_param("codes")) {
+        std::string name;
+        std::stringstream ss{req.get_param_value("codes")};
+        filter.resize(SCRSDK::CrDeviceProperty_MaxVal);
+        while(getline(ss, name, ',')) {
+            int32_t code = CrDevicePropertyCode(name);
+            if(code < 0 || code >= (int32_t)filter.size()) {
+                res.status = 400;
+                res.set_content("unknown property " + name + "\n", "text/plain");
+                return;
+            }
+            filter[code] = 1;
+        }
+    }
+
+    std::shared_ptr<PropertyEventClient> client;
+    {
+        std::lock_guard<std::mutex> lock(m_clientsMutex);
+        client = std::make_shared<PropertyEventClient>(++m_clientId, req.remote_addr + ":" + std::to_string(req.remote_port), window, filter);
+        m_clients.push_back(client);
+    }
+    // the current values first, so a subscriber does not have to poll for them
+    m_propCache.codes(&codes);
+    client->changed((CrInt32u)codes.size(), codes.data());
+
+    res.set_header("Access-Control-Allow-Origin", "*");
+    res.set_header("Cache-Control", "no-cache");
+    res.set_chunked_content_provider(
+        "text/event-stream",
+        [client](size_t offset, httplib::DataSink &sink) {
+            return client->stream(sink);
+        },
+        [client](bool success) {
+            std::lock_guard<std::mutex> lock(m_clientsMutex);
+            m_clients.erase(std::remove(m_clients.begin(), m_clients.end(), client), m_clients.end());
+        }
+    );
+}
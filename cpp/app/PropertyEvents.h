@@ -0,0 +1,85 @@
+/* property change events pushed to http subscribers */
+
+#ifndef PROPERTYEVENTS_H
+#define PROPERTYEVENTS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "httplib.h"
+#include "CRSDK/CameraRemote_SDK.h"
+
+#define PROP_EVENT_KEEPALIVE 15000  // ms without a change before a comment line is sent
+
+struct PropertyEventConfig
+{
+    // ms a burst of changes is collected before it is sent, at most
+    // PROP_EVENT_KEEPALIVE so a stream never goes quiet for longer
+    std::atomic<int> window{100};
+};
+
+extern PropertyEventConfig m_propEventConfig;
+
+struct PropertyEventClientStats
+{
+    int id;
+    std::string addr;
+    int window;
+    int codes;          // filtered codes, 0:all
+    uint64_t events;
+    uint64_t coalesced;
+};
+
+// One /events connection. A changed code is only marked, the value is read
+// from the property cache when the batch is sent, so any number of changes
+// within the window cost one event per code carrying the latest value.
+class PropertyEventClient
+{
+public:
+    // filter is indexed by code, empty for every code
+    PropertyEventClient(int id, const std::string& addr, int window, const std::vector<CrInt8u>& filter);
+
+    void changed(CrInt32u num, const CrInt32u* codes);
+    void close();
+    // send the next batch, false ends the stream
+    bool stream(httplib::DataSink& sink);
+    PropertyEventClientStats stats();
+
+private:
+    int m_id;
+    std::string m_addr;
+    int m_window;
+    std::vector<CrInt8u> m_filter;
+    int m_filterCount;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::vector<CrInt8u> m_dirty;       // by code
+    std::vector<CrInt32u> m_changed;    // dirty codes, in order of their first change
+    std::chrono::steady_clock::time_point m_firstChange;
+    bool m_closed;
+    std::string m_buf;
+
+    std::atomic<uint64_t> m_events;
+    std::atomic<uint64_t> m_coalesced;
+};
+
+// from OnPropertyChangedCodes, after the cache has been refreshed
+void propertyEventsPublish(CrInt32u num, const CrInt32u* codes);
+// ends every stream, before the server is stopped
+void propertyEventsClose();
+
+std::vector<PropertyEventClientStats> getPropertyEventClients();
+// prop_events_* lines for /metrics
+void writePropertyEventMetrics(std::string& out);
+
+// GET /events[?codes=<DP name>,...][&window=<ms>], window is clamped to
+// 0..PROP_EVENT_KEEPALIVE
+void handle_events(const httplib::Request& req, httplib::Response& res);
+
+#endif // PROPERTYEVENTS_H
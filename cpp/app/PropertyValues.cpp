@@ -0,0 +1,91 @@
+#include "PropertyValues.h"
+
+#include <type_traits>
+
+bool decodePropertyValues(CrInt32u valueType, const CrInt8u* data, size_t size, std::vector<int64_t>* values)
+{
+    return visitPropertyValues(valueType, data, size, [&](auto span) {
+        values->resize(span.size());
+        widenPropertyValues(span, values->data());
+    });
+}
+
+// value as T, false when it does not fit either sign or zero extended
+template<typename T>
+static bool _narrow(CrInt64u value, T* narrowed)
+{
+    *narrowed = (T)value;
+    typedef typename std::make_unsigned<T>::type U;
+    return (CrInt64u)(int64_t)*narrowed == value || (CrInt64u)(U)*narrowed == value;
+}
+
+template<typename T>
+static bool _allowed(PropertySpan<T> span, CrInt32u valueType, CrInt64u value)
+{
+    T v;
+    if(!span.size()) return true;
+    if(!_narrow(value, &v)) return false;
+
+    if(valueType & SCRSDK::CrDataType_RangeBit) {
+        if(span.size() < 3) return true;
+        T min = span[0], max = span[1], step = span[2];
+        typedef typename std::make_unsigned<T>::type U;
+        if(v < min || v > max) return false;
+        return step <= 0 || (U)((U)v - (U)min) % (U)step == 0;
+    }
+
+    // counted without early exit so the compare loop vectorizes
+    size_t found = 0;
+    for(size_t i = 0; i < span.size(); i++) found += span[i] == v;
+    return found != 0;
+}
+
+static bool _allowed(PropertySpan<PropertyInt128>, CrInt32u, CrInt64u)
+{
+    return true;
+}
+
+bool propertyValueAllowed(CrInt32u valueType, const CrInt8u* data, size_t size, CrInt64u value)
+{
+    bool allowed = true;
+    if(valueType & SCRSDK::CrDataType_ArrayBit) return true;
+    visitPropertyValues(valueType, data, size, [&](auto span) {
+        allowed = _allowed(span, valueType, value);
+    });
+    return allowed;
+}
+
+void propertyStringToUtf8(const CrInt16u* str, std::string* utf8)
+{
+    utf8->clear();
+    if(!str || !str[0]) return;
+
+    size_t len = str[0];
+    const CrInt16u* p = str + 1;
+    if(!p[len - 1]) len--;  // the terminator
+    for(size_t i = 0; i < len; i++) {
+        uint32_t c = p[i];
+        if(c >= 0xD800 && c < 0xDC00 && i + 1 < len && p[i + 1] >= 0xDC00 && p[i + 1] < 0xE000) {
+            c = 0x10000 + ((c - 0xD800) << 10) + (p[i + 1] - 0xDC00);
+            i++;
+        } else if(c >= 0xD800 && c < 0xE000) {
+            c = 0xFFFD;     // unpaired surrogate
+        }
+
+        if(c < 0x80) {
+            *utf8 += (char)c;
+        } else if(c < 0x800) {
+            *utf8 += (char)(0xC0 | (c >> 6));
+            *utf8 += (char)(0x80 | (c & 0x3F));
+        } else if(c < 0x10000) {
+            *utf8 += (char)(0xE0 | (c >> 12));
+            *utf8 += (char)(0x80 | ((c >> 6) & 0x3F));
+            *utf8 += (char)(0x80 | (c & 0x3F));
+        } else {
+            *utf8 += (char)(0xF0 | (c >> 18));
+            *utf8 += (char)(0x80 | ((c >> 12) & 0x3F));
+            *utf8 += (char)(0x80 | ((c >> 6) & 0x3F));
+            *utf8 += (char)(0x80 | (c & 0x3F));
+        }
+    }
+}
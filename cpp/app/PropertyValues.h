@@ -0,0 +1,108 @@
+/* typed decoding of device property values */
+
+#ifndef PROPERTYVALUES_H
+#define PROPERTYVALUES_H
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+
+// 128 bit values as two halves, little endian like the sdk sends them
+struct PropertyInt128
+{
+    uint64_t lo;
+    uint64_t hi;
+};
+
+// Typed view on the raw value bytes of a property, no copy.
+// The sdk buffer has no alignment guarantee, so elements are read with memcpy.
+template<typename T>
+class PropertySpan
+{
+public:
+    PropertySpan(const CrInt8u* data, size_t bytes) : m_data(data), m_size(data ? bytes / sizeof(T) : 0) {}
+
+    size_t size() const { return m_size; }
+    T operator[](size_t i) const
+    {
+        T value;
+        memcpy(&value, m_data + i * sizeof(T), sizeof(T));
+        return value;
+    }
+
+private:
+    const CrInt8u* m_data;
+    size_t m_size;
+};
+
+enum PropertyValueForm
+{
+    PropertyValueForm_None,     // Undefined or unknown type
+    PropertyValueForm_List,     // possible values
+    PropertyValueForm_Range,    // min, max, step
+    PropertyValueForm_Array,    // the elements of one value
+    PropertyValueForm_String,
+};
+
+inline PropertyValueForm propertyValueForm(CrInt32u valueType)
+{
+    if(valueType == SCRSDK::CrDataType_STR) return PropertyValueForm_String;
+    if((valueType & 0x0FFF) == SCRSDK::CrDataType_Undefined) return PropertyValueForm_None;
+    if(valueType & SCRSDK::CrDataType_RangeBit) return PropertyValueForm_Range;
+    if(valueType & SCRSDK::CrDataType_ArrayBit) return PropertyValueForm_Array;
+    return PropertyValueForm_List;
+}
+
+// Calls f(PropertySpan<T>) with T the element type of valueType, so the type
+// is dispatched once per property and not once per element.
+// Returns false for STR and unknown types, f is not called then.
+template<typename F>
+bool visitPropertyValues(CrInt32u valueType, const CrInt8u* data, size_t size, F&& f)
+{
+    switch(valueType & ~(CrInt32u)(SCRSDK::CrDataType_ArrayBit | SCRSDK::CrDataType_RangeBit)) {
+    case SCRSDK::CrDataType_UInt8:   f(PropertySpan<uint8_t>(data, size)); break;
+    case SCRSDK::CrDataType_Int8:    f(PropertySpan<int8_t>(data, size)); break;
+    case SCRSDK::CrDataType_UInt16:  f(PropertySpan<uint16_t>(data, size)); break;
+    case SCRSDK::CrDataType_Int16:   f(PropertySpan<int16_t>(data, size)); break;
+    case SCRSDK::CrDataType_UInt32:  f(PropertySpan<uint32_t>(data, size)); break;
+    case SCRSDK::CrDataType_Int32:   f(PropertySpan<int32_t>(data, size)); break;
+    case SCRSDK::CrDataType_UInt64:  f(PropertySpan<uint64_t>(data, size)); break;
+    case SCRSDK::CrDataType_Int64:   f(PropertySpan<int64_t>(data, size)); break;
+    case SCRSDK::CrDataType_UInt128:
+    case SCRSDK::CrDataType_Int128:  f(PropertySpan<PropertyInt128>(data, size)); break;
+    default: return false;
+    }
+    return true;
+}
+
+// Values widened to int64_t, a plain loop the compiler vectorizes.
+// 128 bit values keep their low half.
+template<typename T>
+void widenPropertyValues(PropertySpan<T> span, int64_t* __restrict out)
+{
+    for(size_t i = 0; i < span.size(); i++) out[i] = (int64_t)span[i];
+}
+
+template<>
+inline void widenPropertyValues(PropertySpan<PropertyInt128> span, int64_t* __restrict out)
+{
+    for(size_t i = 0; i < span.size(); i++) out[i] = (int64_t)span[i].lo;
+}
+
+// Possible values of a property widened to int64_t, for a range min, max and step.
+// Returns false for STR and unknown types.
+bool decodePropertyValues(CrInt32u valueType, const CrInt8u* data, size_t size, std::vector<int64_t>* values);
+
+// False only when the possible values rule value out: not in the list, or
+// outside the range or off its step. An empty list, arrays and 128 bit types
+// can not be checked and allow everything.
+bool propertyValueAllowed(CrInt32u valueType, const CrInt8u* data, size_t size, CrInt64u value);
+
+// STR properties come as UTF-16 with the length (terminator included) in front.
+// Replaces the contents of utf8, which keeps its capacity between calls.
+void propertyStringToUtf8(const CrInt16u* str, std::string* utf8);
+
+#endif // PROPERTYVALUES_H
@@ -0,0 +1,119 @@
+#include "PtzApi.h"
+
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "PtzControl.h"
+
+static std::atomic<bool> m_attached(false);
+
+int ptzf_attach(int64_t device_handle)
+{
+    if(!device_handle) return SCRSDK::CrError_Generic_InvalidHandle;
+    m_ptz.start(device_handle);
+    m_attached = true;
+    return 0;
+}
+
+void ptzf_detach(void)
+{
+    m_attached = false;
+    m_ptz.stop();
+}
+
+int ptzf_direction(int32_t pan_speed, int32_t tilt_speed)
+{
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    if(!pan_speed && !tilt_speed) return m_ptz.halt();
+    m_ptz.direction(pan_speed, tilt_speed);
+    return 0;
+}
+
+int ptzf_zoom(int32_t speed)
+{
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    if(speed < -32767 || speed > 32767) return SCRSDK::CrError_Generic_InvalidParameter;
+    m_ptz.zoom((CrInt16)speed);
+    return 0;
+}
+
+static int _move(SCRSDK::CrPTZFControlType type, int32_t pan, int32_t tilt, int32_t pan_speed, int32_t tilt_speed)
+{
+    SCRSDK::CrPTZFSetting setting;
+
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    setting.pan.exists = 1;
+    setting.pan.position = pan;
+    setting.pan.speed = pan_speed;
+    setting.tilt.exists = 1;
+    setting.tilt.position = tilt;
+    setting.tilt.speed = tilt_speed;
+    return m_ptz.move(type, &setting);
+}
+
+int ptzf_absolute(int32_t pan, int32_t tilt, int32_t pan_speed, int32_t tilt_speed)
+{
+    return _move(SCRSDK::CrPTZFControlType_Absolute, pan, tilt, pan_speed, tilt_speed);
+}
+
+int ptzf_relative(int32_t pan, int32_t tilt, int32_t pan_speed, int32_t tilt_speed)
+{
+    return _move(SCRSDK::CrPTZFControlType_Relative, pan, tilt, pan_speed, tilt_speed);
+}
+
+int ptzf_home(void)
+{
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    return m_ptz.move(SCRSDK::CrPTZFControlType_HomePosition, nullptr);
+}
+
+int ptzf_stop(void)
+{
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    return m_ptz.halt();
+}
+
+int ptzf_cancel(void)
+{
+    if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+    return m_ptz.cancel();
+}
+
+int controlPTZF(const char* inputLine)
+{
+    // type, pan, tilt, pan speed, tilt speed
+    long args[5] = { 0, 0, 0, PTZF_SPEED_DEFAULT, PTZF_SPEED_DEFAULT };
+    int num = 0;
+    const char* p = inputLine;
+    char* end = nullptr;
+
+    if(!p) return SCRSDK::CrError_Generic_InvalidParameter;
+    while(num < 5) {
+        long value = strtol(p, &end, 0);
+        if(end == p) break;
+        args[num++] = value;
+        p = end;
+    }
+    while(isspace((unsigned char)*p)) p++;
+    if(num == 0 || *p) return SCRSDK::CrError_Generic_InvalidParameter;
+
+    switch(args[0]) {
+    case SCRSDK::CrPTZFControlType_Absolute:
+        return ptzf_absolute((int32_t)args[1], (int32_t)args[2], (int32_t)args[3], (int32_t)args[4]);
+    case SCRSDK::CrPTZFControlType_Relative:
+        return ptzf_relative((int32_t)args[1], (int32_t)args[2], (int32_t)args[3], (int32_t)args[4]);
+    case SCRSDK::CrPTZFControlType_Direction:
+        return ptzf_direction((int32_t)args[3], (int32_t)args[4]);
+    case SCRSDK::CrPTZFControlType_HomePosition:
+        return ptzf_home();
+    case SCRSDK::CrPTZFControlType_Cancel:
+        return ptzf_cancel();
+    case SCRSDK::CrPTZFControlType_Reset:
+        if(!m_attached) return SCRSDK::CrError_Generic_InvalidHandle;
+        return m_ptz.move(SCRSDK::CrPTZFControlType_Reset, nullptr);
+    default:
+        return SCRSDK::CrError_Generic_InvalidParameter;
+    }
+}
@@ -0,0 +1,54 @@
+/* typed C entry points for pan/tilt/zoom control */
+
+#ifndef PTZAPI_H
+#define PTZAPI_H
+
+#include <stdint.h>
+
+// PTZF_EXPORTS when building the shared library, PTZF_STATIC when the
+// sources are compiled straight into a program
+#if defined(PTZF_STATIC)
+  #define PTZF_API
+#elif defined(_WIN32) || defined(_WIN64)
+  #if defined(PTZF_EXPORTS)
+    #define PTZF_API __declspec(dllexport)
+  #else
+    #define PTZF_API __declspec(dllimport)
+  #endif
+#else
+  #define PTZF_API __attribute__((visibility("default")))
+#endif
+
+#define PTZF_SPEED_DEFAULT 50   // speed the string form uses when none is given
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Binds the calls below to a connected device and starts the sender. Until
+// then every call fails with CrError_Generic_InvalidHandle.
+PTZF_API int ptzf_attach(int64_t device_handle);
+PTZF_API void ptzf_detach(void);
+
+// Joystick intent, latest wins and is sent at the configured rate.
+// Signed speeds, 0/0 stops at once.
+PTZF_API int ptzf_direction(int32_t pan_speed, int32_t tilt_speed);
+// ZoomOperationWithInt16 speed, latest wins, 0 stops
+PTZF_API int ptzf_zoom(int32_t speed);
+
+// Sent at once, drop any intent not sent yet.
+PTZF_API int ptzf_absolute(int32_t pan, int32_t tilt, int32_t pan_speed, int32_t tilt_speed);
+PTZF_API int ptzf_relative(int32_t pan, int32_t tilt, int32_t pan_speed, int32_t tilt_speed);
+PTZF_API int ptzf_home(void);
+PTZF_API int ptzf_stop(void);
+PTZF_API int ptzf_cancel(void);
+
+// "<type> [pan] [tilt] [pan speed] [tilt speed]" with CrPTZFControlType
+// numbering, e.g. "3 0 0 20 -10" for direction. Parsed in place.
+PTZF_API int controlPTZF(const char* inputLine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // PTZAPI_H
@@ -0,0 +1,419 @@
+#include "PtzControl.h"
+
+#include <algorithm>
+
+#include "Metrics.h"
+#include "RemoteCli.h"
+
+PtzControl m_ptz;
+
+const char* ptzMoveStatusString(PtzMoveStatus status)
+{
+    switch(status) {
+    case PtzMove_Completed:     return "completed";
+    case PtzMove_NG:            return "NG";
+    case PtzMove_Canceled:      return "canceled";
+    case PtzMove_Interrupted:   return "interrupted";
+    case PtzMove_DriveError:    return "drive error";
+    case PtzMove_Timeout:       return "timeout";
+    case PtzMove_Failed:        return "failed";
+    }
+    return "unknown";
+}
+
+// reported done by a PresetPTZFEvent after the result
+static bool _isDrive(SCRSDK::CrPTZFControlType type)
+{
+    return type == SCRSDK::CrPTZFControlType_Absolute
+        || type == SCRSDK::CrPTZFControlType_Relative
+        || type == SCRSDK::CrPTZFControlType_HomePosition;
+}
+
+PtzControl::PtzControl()
+    : m_device_handle(0)
+    , m_running(false)
+    , m_rate(PTZ_RATE)
+    , m_intent{ 0, 0, 0 }
+    , m_sent{ 0, 0, 0 }
+    , m_dirty(false)
+    , m_generation(0)
+    , m_moveId(0)
+    , m_sentCount(0)
+    , m_coalesced(0)
+    , m_preempted(0)
+{
+}
+
+PtzControl::~PtzControl()
+{
+    stop();
+}
+
+void PtzControl::start(int64_t device_handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_running) return;
+    m_device_handle = device_handle;
+    m_running = true;
+    m_thread = std::thread([this] { run(); });
+}
+
+void PtzControl::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_running) return;
+        m_running = false;
+    }
+    m_cond.notify_one();
+    if(m_thread.joinable()) m_thread.join();
+    abortMoves(SCRSDK::CrError_Connect_Disconnected);
+}
+
+bool PtzControl::changed() const
+{
+    return m_intent.pan != m_sent.pan || m_intent.tilt != m_sent.tilt || m_intent.zoom != m_sent.zoom;
+}
+
+void PtzControl::direction(CrInt32 pan, CrInt32 tilt)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_dirty) m_coalesced++;
+        m_intent.pan = pan;
+        m_intent.tilt = tilt;
+        m_dirty = changed();
+    }
+    m_cond.notify_one();
+}
+
+void PtzControl::zoom(CrInt16 speed)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_dirty) m_coalesced++;
+        m_intent.zoom = speed;
+        m_dirty = changed();
+    }
+    m_cond.notify_one();
+}
+
+void PtzControl::preempt()
+{
+    if(m_dirty) m_preempted++;
+    m_dirty = false;
+    m_generation++;
+}
+
+SCRSDK::CrError PtzControl::stream(CrInt32 pan, CrInt32 tilt, CrInt16 zoom)
+{
+    Intent sent;
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        preempt();
+        sent = m_sent;
+        generation = m_generation;
+        m_intent = m_sent = Intent{ pan, tilt, zoom };
+    }
+
+    SCRSDK::CrError err = 0;
+    bool directionSent = false;
+    {
+        std::lock_guard<std::mutex> send(m_sendMutex);
+        if(pan != sent.pan || tilt != sent.tilt) err = sendDirection(pan, tilt);
+        if(!err && zoom != sent.zoom) err = sendZoom(zoom);
+    }
+    if(err) {
+        // as in sendIntent(), the next command is compared with what the camera got
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_generation == generation) m_intent = m_sent = sent;
+    }
+    return err;
+}
+
+SCRSDK::CrError PtzControl::halt()
+{
+    bool zooming;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        preempt();
+        zooming = m_sent.zoom != 0;
+        m_intent = m_sent = Intent{ 0, 0, 0 };
+    }
+    std::lock_guard<std::mutex> send(m_sendMutex);
+    SCRSDK::CrError err = sendDirection(0, 0);
+    if(zooming) {
+        SCRSDK::CrError zoomErr = sendZoom(0);
+        if(!err) err = zoomErr;
+    }
+    return err;
+}
+
+SCRSDK::CrError PtzControl::cancel()
+{
+    return move(SCRSDK::CrPTZFControlType_Cancel, nullptr);
+}
+
+void PtzControl::beginMove()
+{
+    preempt();
+    // a move ends any direction drive, the next intent starts from rest
+    m_intent.pan = m_intent.tilt = m_sent.pan = m_sent.tilt = 0;
+    m_intent.zoom = m_sent.zoom;
+}
+
+SCRSDK::CrError PtzControl::move(SCRSDK::CrPTZFControlType type, const SCRSDK::CrPTZFSetting* setting)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        beginMove();
+    }
+    std::lock_guard<std::mutex> send(m_sendMutex);
+    m_sentCount++;
+    return SCRSDK::ControlPTZF(m_device_handle, type, setting);
+}
+
+std::future<PtzMoveResult> PtzControl::addMove(SCRSDK::CrPTZFControlType type, bool accepted, int timeout_ms,
+    std::function<void()> done, uint64_t* id)
+{
+    beginMove();
+    m_moves.emplace_back();
+    Move& move = m_moves.back();
+    move.id = *id = ++m_moveId;
+    move.type = type;
+    move.accepted = accepted;
+    move.sent = std::chrono::steady_clock::now();
+    move.deadline = move.sent + std::chrono::milliseconds(timeout_ms);
+    move.done = done;
+    return move.promise.get_future();
+}
+
+void PtzControl::failMove(uint64_t id, SCRSDK::CrError err)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::list<Move>::iterator move = std::find_if(m_moves.begin(), m_moves.end(), [&](const Move& m) { return m.id == id; });
+    if(move != m_moves.end()) resolve(move, PtzMove_Failed, err);
+}
+
+std::future<PtzMoveResult> PtzControl::moveAsync(SCRSDK::CrPTZFControlType type, const SCRSDK::CrPTZFSetting* setting,
+    int timeout_ms, std::function<void()> done)
+{
+    std::future<PtzMoveResult> future;
+    uint64_t id;
+    SCRSDK::CrError err;
+
+    // registered before it is sent, the result may come back at once
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        future = addMove(type, false, timeout_ms, done, &id);
+    }
+    m_cond.notify_one();    // new deadline for the sender
+
+    {
+        std::lock_guard<std::mutex> send(m_sendMutex);
+        m_sentCount++;
+        err = SCRSDK::ControlPTZF(m_device_handle, type, setting);
+    }
+    if(err) failMove(id, err);
+    return future;
+}
+
+std::future<PtzMoveResult> PtzControl::recallAsync(CrInt16u slot, int timeout_ms, std::function<void()> done)
+{
+    std::future<PtzMoveResult> future;
+    SCRSDK::CrDeviceProperty prop;
+    uint64_t id;
+    SCRSDK::CrError err;
+
+    // no ControlPTZFResult comes for a recall, only the drive event
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        future = addMove((SCRSDK::CrPTZFControlType)0, true, timeout_ms, done, &id);
+    }
+    m_cond.notify_one();
+
+    prop.SetCode(SCRSDK::CrDeviceProperty_PresetPTZFSlotNumber);
+    prop.SetValueType(SCRSDK::CrDataType_UInt16);
+    prop.SetCurrentValue(slot);
+    {
+        std::lock_guard<std::mutex> send(m_sendMutex);
+        m_sentCount++;
+        err = SCRSDK::SetDeviceProperty(m_device_handle, &prop);
+    }
+    if(err) failMove(id, err);
+    return future;
+}
+
+void PtzControl::resolve(std::list<Move>::iterator move, PtzMoveStatus status, SCRSDK::CrError err)
+{
+    PtzMoveResult result;
+    result.status = status;
+    result.err = err;
+    result.ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - move->sent).count();
+    move->promise.set_value(result);
+    if(move->done) move->done();
+    m_moves.erase(move);
+}
+
+void PtzControl::warningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2, CrInt32 param3)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(warning == SCRSDK::CrWarningExt_ControlPTZFResult) {
+        // param1: error, param2: result, param3: control type
+        std::list<Move>::iterator move = std::find_if(m_moves.begin(), m_moves.end(),
+            [&](const Move& m) { return !m.accepted && m.type == (SCRSDK::CrPTZFControlType)param3; });
+        if(move == m_moves.end()) return;
+
+        if(param2 == SCRSDK::CrWarningExtParam_ControlPTZFResult_OK) {
+            if(_isDrive(move->type)) move->accepted = true;
+            else resolve(move, PtzMove_Completed);
+        } else if(param2 == SCRSDK::CrWarningExtParam_ControlPTZFResult_Canceled) {
+            resolve(move, PtzMove_Canceled, param1);
+        } else {
+            resolve(move, PtzMove_NG, param1);
+        }
+    } else if(warning == SCRSDK::CrWarningExt_PresetPTZFEvent) {
+        // param1: event. It names no command, so it ends the oldest running
+        // drive, or one whose result has not come yet.
+        std::list<Move>::iterator move = std::find_if(m_moves.begin(), m_moves.end(), [](const Move& m) { return m.accepted; });
+        if(move == m_moves.end()) {
+            move = std::find_if(m_moves.begin(), m_moves.end(), [](const Move& m) { return _isDrive(m.type); });
+        }
+        if(move == m_moves.end()) return;
+
+        if(param1 == SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveCompleted) resolve(move, PtzMove_Completed);
+        else if(param1 == SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveInterrupted) resolve(move, PtzMove_Interrupted);
+        else if(param1 == SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveError) resolve(move, PtzMove_DriveError);
+    }
+}
+
+void PtzControl::abortMoves(SCRSDK::CrError err)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while(!m_moves.empty()) resolve(m_moves.begin(), PtzMove_Failed, err);
+}
+
+void PtzControl::expireMoves(std::chrono::steady_clock::time_point now)
+{
+    for(std::list<Move>::iterator move = m_moves.begin(); move != m_moves.end(); ) {
+        std::list<Move>::iterator next = std::next(move);
+        if(move->deadline <= now) resolve(move, PtzMove_Timeout);
+        move = next;
+    }
+}
+
+void PtzControl::setRate(int rate)
+{
+    if(rate > 0) m_rate = rate;
+    m_cond.notify_one();
+}
+
+SCRSDK::CrError PtzControl::sendDirection(CrInt32 pan, CrInt32 tilt)
+{
+    SCRSDK::CrPTZFSetting setting;
+    setting.pan.exists = 1;
+    setting.pan.speed = pan;
+    setting.tilt.exists = 1;
+    setting.tilt.speed = tilt;
+    m_sentCount++;
+    return SCRSDK::ControlPTZF(m_device_handle, SCRSDK::CrPTZFControlType_Direction, &setting);
+}
+
+SCRSDK::CrError PtzControl::sendZoom(CrInt16 speed)
+{
+    SCRSDK::CrDeviceProperty prop;
+    prop.SetCode(SCRSDK::CrDeviceProperty_ZoomOperationWithInt16);
+    prop.SetValueType(SCRSDK::CrDataType_Int16);
+    prop.SetCurrentValue((CrInt64u)(CrInt64)speed);
+    m_sentCount++;
+    return SCRSDK::SetDeviceProperty(m_device_handle, &prop);
+}
+
+void PtzControl::run()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for(;;) {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        expireMoves(now);
+        if(!m_running) break;
+
+        std::chrono::steady_clock::time_point wake = std::chrono::steady_clock::time_point::max();
+        if(m_dirty) {
+            // rate limit, intents arriving meanwhile replace the one waiting
+            std::chrono::steady_clock::time_point next = m_lastSend + std::chrono::microseconds(1000000 / m_rate);
+            if(now >= next) {
+                sendIntent(lock);
+                continue;
+            }
+            wake = next;
+        }
+        for(Move& move : m_moves) wake = std::min(wake, move.deadline);
+
+        if(wake == std::chrono::steady_clock::time_point::max()) m_cond.wait(lock);
+        else m_cond.wait_until(lock, wake);
+    }
+}
+
+void PtzControl::sendIntent(std::unique_lock<std::mutex>& lock)
+{
+    Intent intent = m_intent;
+    Intent sent = m_sent;
+    uint64_t generation = m_generation;
+    m_sent = intent;
+    m_dirty = false;
+    m_lastSend = std::chrono::steady_clock::now();
+    lock.unlock();
+
+    SCRSDK::CrError err = 0;
+    bool directionSent = false;
+    {
+        std::lock_guard<std::mutex> send(m_sendMutex);
+        bool current;
+        {
+            std::lock_guard<std::mutex> check(m_mutex);
+            current = generation == m_generation;
+        }
+        // a stop or move went out since the intent was taken
+        if(!current) {
+            m_preempted++;
+        } else {
+            if(intent.pan != sent.pan || intent.tilt != sent.tilt) {
+                err = sendDirection(intent.pan, intent.tilt);
+                directionSent = !err;
+            }
+            if(!err && intent.zoom != sent.zoom) err = sendZoom(intent.zoom);
+        }
+    }
+    if(err) PrintError("ptz", err);
+
+    lock.lock();
+    // the camera keeps what it had, run() sends again at the rate limit
+    // unless the intent has come back to that meanwhile
+    if(err && m_generation == generation) {
+        if(directionSent) {
+            sent.pan = intent.pan;
+            sent.tilt = intent.tilt;
+        }
+        m_sent = sent;
+        m_dirty = changed();
+    }
+}
+
+PtzStats PtzControl::stats()
+{
+    PtzStats stats;
+    stats.sent = m_sentCount;
+    stats.coalesced = m_coalesced;
+    stats.preempted = m_preempted;
+    stats.rate = m_rate;
+    return stats;
+}
+
+void writePtzMetrics(std::string& out)
+{
+    PtzStats stats = m_ptz.stats();
+    metricsLine(out, "ptz_commands_sent_total", stats.sent);
+    metricsLine(out, "ptz_commands_coalesced_total", stats.coalesced);
+    metricsLine(out, "ptz_commands_preempted_total", stats.preempted);
+}
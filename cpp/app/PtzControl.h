@@ -0,0 +1,166 @@
+/* latest-wins pan/tilt/zoom control channel */
+
+#ifndef PTZCONTROL_H
+#define PTZCONTROL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "CRSDK/CameraRemote_SDK.h"
+
+#define PTZ_RATE 20     // commands per second, default
+#define PTZ_MOVE_TIMEOUT 30000  // ms until an unanswered move resolves as timed out
+
+enum PtzMoveStatus
+{
+    PtzMove_Completed,      // ControlPTZFResult OK, for drives also DriveCompleted
+    PtzMove_NG,             // ControlPTZFResult NG
+    PtzMove_Canceled,       // ControlPTZFResult Canceled
+    PtzMove_Interrupted,    // DriveInterrupted, e.g. by a newer move or a stop
+    PtzMove_DriveError,     // DriveError
+    PtzMove_Timeout,        // nothing reported in time
+    PtzMove_Failed,         // ControlPTZF failed or the camera went away, see err
+};
+
+struct PtzMoveResult
+{
+    PtzMoveStatus status;
+    SCRSDK::CrError err;    // from ControlPTZF or the result warning
+    int64_t ns;             // sent to resolved
+};
+
+const char* ptzMoveStatusString(PtzMoveStatus status);
+
+struct PtzStats
+{
+    uint64_t sent;          // commands sent to the camera
+    uint64_t coalesced;     // intents replaced by a newer one before they were sent
+    uint64_t preempted;     // intents dropped by a stop, cancel or move
+    int rate;
+};
+
+// Joystick style control. direction() and zoom() only record the operator's
+// latest intent; a sender thread sends it when it changed, at most rate
+// times a second, so a burst of stick movements never queues up stale
+// commands behind it. halt(), cancel() and move() go out at once from the
+// caller and drop whatever intent has not been sent yet, and so does
+// stream().
+class PtzControl
+{
+public:
+    PtzControl();
+    ~PtzControl();
+
+    void start(int64_t device_handle);
+    void stop();
+
+    // signed speeds, 0 stops the axis
+    void direction(CrInt32 pan, CrInt32 tilt);
+    // ZoomOperationWithInt16 speed, 0 stops
+    void zoom(CrInt16 speed);
+
+    // For a stream where every command counts, like a trajectory whose
+    // ticks add up to its distance: sends the speeds that changed at once
+    // from the caller instead of through the sender, so none is coalesced
+    // away. Drops the unsent intent like halt().
+    SCRSDK::CrError stream(CrInt32 pan, CrInt32 tilt, CrInt16 zoom);
+    // stops pan, tilt and zoom
+    SCRSDK::CrError halt();
+    // CrPTZFControlType_Cancel, aborts a running absolute/relative/home move
+    SCRSDK::CrError cancel();
+    // any other ControlPTZF
+    SCRSDK::CrError move(SCRSDK::CrPTZFControlType type, const SCRSDK::CrPTZFSetting* setting);
+    // Like move(), the future resolves when the camera reports the result:
+    // ControlPTZFResult, and for absolute, relative and home drives the
+    // PresetPTZFEvent after it. Results are matched to the oldest open move
+    // of the same type. done is called once the future is ready, with the
+    // control's lock held, so it must not call back into it.
+    std::future<PtzMoveResult> moveAsync(SCRSDK::CrPTZFControlType type, const SCRSDK::CrPTZFSetting* setting,
+        int timeout_ms = PTZ_MOVE_TIMEOUT, std::function<void()> done = nullptr);
+    // recalls a preset through PresetPTZFSlotNumber, resolved by the
+    // PresetPTZFEvent of the drive
+    std::future<PtzMoveResult> recallAsync(CrInt16u slot, int timeout_ms = PTZ_MOVE_TIMEOUT, std::function<void()> done = nullptr);
+
+    // from OnWarningExt, resolves open moves
+    void warningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2, CrInt32 param3);
+    // fails every open move, e.g. on disconnect
+    void abortMoves(SCRSDK::CrError err);
+
+    void setRate(int rate);
+    int rate() const { return m_rate; }
+    PtzStats stats();
+
+private:
+    struct Intent
+    {
+        CrInt32 pan;
+        CrInt32 tilt;
+        CrInt16 zoom;
+    };
+
+    // a moveAsync() waiting for its result
+    struct Move
+    {
+        uint64_t id;
+        SCRSDK::CrPTZFControlType type;     // 0 for a preset recall
+        bool accepted;      // result OK or a recall, the drive is still running
+        std::chrono::steady_clock::time_point sent;
+        std::chrono::steady_clock::time_point deadline;
+        std::promise<PtzMoveResult> promise;
+        std::function<void()> done;
+    };
+
+    void run();
+    // with m_mutex held, takes the intent and sends it
+    void sendIntent(std::unique_lock<std::mutex>& lock);
+    // with m_mutex held
+    void beginMove();
+    std::future<PtzMoveResult> addMove(SCRSDK::CrPTZFControlType type, bool accepted, int timeout_ms,
+        std::function<void()> done, uint64_t* id);
+    void failMove(uint64_t id, SCRSDK::CrError err);
+    void resolve(std::list<Move>::iterator move, PtzMoveStatus status, SCRSDK::CrError err = 0);
+    void expireMoves(std::chrono::steady_clock::time_point now);
+    // with m_mutex held
+    bool changed() const;
+    // with m_mutex held, drops the unsent intent
+    void preempt();
+    SCRSDK::CrError sendDirection(CrInt32 pan, CrInt32 tilt);
+    SCRSDK::CrError sendZoom(CrInt16 speed);
+
+    int64_t m_device_handle;
+    std::thread m_thread;
+    bool m_running;
+    std::atomic<int> m_rate;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    Intent m_intent;        // latest wanted
+    Intent m_sent;          // last sent
+    bool m_dirty;           // m_intent differs from m_sent
+    uint64_t m_generation;  // bumped by every pre-empting command
+    std::chrono::steady_clock::time_point m_lastSend;
+    std::list<Move> m_moves;
+    uint64_t m_moveId;
+
+    // held while a command is sent, orders the sender against pre-empting commands
+    std::mutex m_sendMutex;
+
+    std::atomic<uint64_t> m_sentCount;
+    std::atomic<uint64_t> m_coalesced;
+    std::atomic<uint64_t> m_preempted;
+};
+
+extern PtzControl m_ptz;
+
+// ptz_* lines for /metrics
+void writePtzMetrics(std::string& out);
+
+#endif // PTZCONTROL_H
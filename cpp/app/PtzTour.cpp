@@ -0,0 +1,272 @@
+#include "PtzTour.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "PtzApi.h"
+#include "RemoteCli.h"
+
+PtzTour m_ptzTour;
+
+// "<key>=<number>", false when the token has another key
+static bool _option(const std::string& token, const char* key, long* value, long* second = nullptr)
+{
+    size_t len = strlen(key);
+    const char* p;
+    char* end = nullptr;
+
+    if(token.compare(0, len, key) || token.size() <= len || token[len] != '=') return false;
+    p = token.c_str() + len + 1;
+    *value = strtol(p, &end, 0);
+    if(end == p) return false;
+    if(second) {
+        *second = *value;
+        if(*end == ',') {
+            p = end + 1;
+            *second = strtol(p, &end, 0);
+            if(end == p) return false;
+        }
+    }
+    return *end == 0;
+}
+
+SCRSDK::CrError ptzTourRead(const std::string& path, std::vector<PtzTourStep>* steps)
+{
+    SCRSDK::CrError result = SCRSDK::CrError_Generic_Unknown;
+    std::ifstream file(path);
+    std::string line;
+    int lineNo = 0;
+
+    steps->clear();
+    if(!file) GotoError("can not open", 0);
+    while(std::getline(file, line)) {
+        std::istringstream in(line.substr(0, line.find('#')));
+        std::string kind, token;
+        PtzTourStep step = { false, 0, 0, 0, PTZF_SPEED_DEFAULT, PTZF_SPEED_DEFAULT, 0, (int)steps->size() + 1, PTZ_MOVE_TIMEOUT };
+        long a = 0, b = 0;
+        bool ok = true;
+
+        lineNo++;
+        if(!(in >> kind)) continue;
+        if(kind == "preset") {
+            step.preset = true;
+            ok = (in >> a) && a > 0 && a <= 0xffff;
+            step.slot = (CrInt16u)a;
+        } else if(kind == "abs") {
+            ok = (bool)(in >> a >> b);
+            step.pan = (CrInt32)a;
+            step.tilt = (CrInt32)b;
+        } else {
+            ok = false;
+        }
+        while(ok && in >> token) {
+            if(_option(token, "speed", &a, &b)) { step.panSpeed = (CrInt32)a; step.tiltSpeed = (CrInt32)b; }
+            else if(_option(token, "dwell", &a) && a >= 0) step.dwell = (int)a;
+            else if(_option(token, "next", &a) && a >= -1) step.next = (int)a;
+            else if(_option(token, "timeout", &a) && a > 0) step.timeout = (int)a;
+            else ok = false;
+        }
+        if(!ok) {
+            fprintf(stderr, "%s:%d: invalid step\n", path.c_str(), lineNo);
+            GotoError("", 0);
+        }
+        steps->push_back(step);
+    }
+    if(steps->empty()) GotoError("no steps", 0);
+    // the default next of the last step runs off the end
+    if(steps->back().next == (int)steps->size()) steps->back().next = -1;
+    for(size_t i = 0; i < steps->size(); i++) {
+        if(steps->at(i).next >= (int)steps->size()) {
+            fprintf(stderr, "%s: step %d: no step %d\n", path.c_str(), (int)i, steps->at(i).next);
+            GotoError("", 0);
+        }
+    }
+    result = 0;
+Error:
+    return result;
+}
+
+PtzTour::PtzTour()
+    : m_running(false)
+    , m_stopping(false)
+    , m_driving(false)
+{
+}
+
+PtzTour::~PtzTour()
+{
+    stop();
+}
+
+SCRSDK::CrError PtzTour::start(const std::vector<PtzTourStep>& steps)
+{
+    if(steps.empty()) return SCRSDK::CrError_Generic_InvalidParameter;
+    stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_steps = steps;
+    m_records.clear();
+    m_stopping = false;
+    m_driving = false;
+    m_running = true;
+    m_waker = std::make_shared<Waker>();
+    m_waker->tour = this;
+    m_thread = std::thread([this] { run(); });
+    return 0;
+}
+
+void PtzTour::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_cond.notify_all();
+    if(m_thread.joinable()) m_thread.join();
+    if(m_waker) {
+        std::lock_guard<std::mutex> lock(m_waker->mutex);
+        m_waker->tour = nullptr;
+    }
+
+    // the head would go on to the step's target
+    bool driving;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        driving = m_driving;
+        m_driving = false;
+    }
+    if(driving) m_ptz.cancel();
+}
+
+bool PtzTour::running()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_running;
+}
+
+void PtzTour::records(std::vector<PtzTourRecord>* records)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    records->assign(m_records.begin(), m_records.end());
+}
+
+void PtzTour::record(const PtzTourRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_records.size() >= PTZ_TOUR_RECORDS) m_records.pop_front();
+    m_records.push_back(record);
+}
+
+bool PtzTour::waitUntil(std::chrono::steady_clock::time_point due)
+{
+    // condition variable waits wake up to a scheduler tick late, so sleep
+    // until shortly before and spin the rest
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if(m_cond.wait_until(lock, due - std::chrono::microseconds(PTZ_TOUR_SPIN_US), [this] { return m_stopping; })) return false;
+    lock.unlock();
+    while(std::chrono::steady_clock::now() < due) std::this_thread::yield();
+    return true;
+}
+
+void PtzTour::run()
+{
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point due = begin;
+    uint64_t seq = 0;
+    int index = 0;
+
+    while(index >= 0 && waitUntil(due)) {
+        const PtzTourStep& step = m_steps[index];
+        std::future<PtzMoveResult> future;
+        std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+        // wakes the wait below, under the lock so the wakeup is not lost
+        std::shared_ptr<Waker> waker = m_waker;
+        auto done = [waker] {
+            std::lock_guard<std::mutex> lock(waker->mutex);
+            if(!waker->tour) return;
+            std::lock_guard<std::mutex> tourLock(waker->tour->m_mutex);
+            waker->tour->m_cond.notify_all();
+        };
+
+        if(step.preset) {
+            future = m_ptz.recallAsync(step.slot, step.timeout, done);
+        } else {
+            SCRSDK::CrPTZFSetting setting;
+            setting.pan.exists = 1;
+            setting.pan.position = step.pan;
+            setting.pan.speed = step.panSpeed;
+            setting.tilt.exists = 1;
+            setting.tilt.position = step.tilt;
+            setting.tilt.speed = step.tiltSpeed;
+            future = m_ptz.moveAsync(SCRSDK::CrPTZFControlType_Absolute, &setting, step.timeout, done);
+        }
+
+        // the future resolves by itself at the step timeout at the latest
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [&] { return m_stopping || future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+            if(m_stopping && future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                m_driving = true;
+                break;
+            }
+        }
+
+        PtzMoveResult res = future.get();
+        std::chrono::steady_clock::time_point arrived = std::chrono::steady_clock::now();
+        PtzTourRecord rec;
+        rec.seq = ++seq;
+        rec.step = index;
+        rec.planned = std::chrono::duration_cast<std::chrono::nanoseconds>(due - begin).count();
+        rec.late = std::chrono::duration_cast<std::chrono::nanoseconds>(sent - due).count();
+        rec.move = std::chrono::duration_cast<std::chrono::nanoseconds>(arrived - sent).count();
+        rec.status = res.status;
+        late.record(rec.late);
+        if(res.status == PtzMove_Completed) move.record(rec.move);
+        record(rec);
+
+        printf("  tour %llu: step %d %s %.1fms, late %.3fms\n", (unsigned long long)rec.seq, index,
+            ptzMoveStatusString(res.status), rec.move / 1e6, rec.late / 1e6);
+        // nothing more will get through
+        if(res.status == PtzMove_Failed && res.err == SCRSDK::CrError_Connect_Disconnected) break;
+        due = arrived + std::chrono::milliseconds(step.dwell);
+        index = step.next;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_running = false;
+    if(index < 0) printf("  tour done\n");
+}
+
+SCRSDK::CrError _ptzTourStart(const std::string& path)
+{
+    std::vector<PtzTourStep> steps;
+    SCRSDK::CrError err = ptzTourRead(path, &steps);
+    if(err) return err;
+    printf("  %d steps\n", (int)steps.size());
+    return m_ptzTour.start(steps);
+}
+
+void _ptzTourStatus()
+{
+    std::vector<PtzTourRecord> records;
+    m_ptzTour.records(&records);
+    printf("  %s\n", m_ptzTour.running() ? "running" : "stopped");
+    for(const PtzTourRecord& rec : records) {
+        printf("  %llu step %d: due %.1fms late %.3fms move %.1fms %s\n", (unsigned long long)rec.seq, rec.step,
+            rec.planned / 1e6, rec.late / 1e6, rec.move / 1e6, ptzMoveStatusString(rec.status));
+    }
+    if(m_ptzTour.late.count()) {
+        printf("  late p50 %.3fms p99 %.3fms max %.3fms\n", m_ptzTour.late.percentile(0.5) / 1e6,
+            m_ptzTour.late.percentile(0.99) / 1e6, m_ptzTour.late.max() / 1e6);
+    }
+}
+
+void writePtzTourMetrics(std::string& out)
+{
+    metricsLine(out, "ptz_tour_running", (uint64_t)m_ptzTour.running());
+    if(m_ptzTour.late.count()) m_ptzTour.late.write(out, "ptz_tour_start_late_ns");
+    if(m_ptzTour.move.count()) m_ptzTour.move.write(out, "ptz_tour_move_ns");
+}
@@ -0,0 +1,106 @@
+/* preset tours: scheduled preset recalls and absolute moves */
+
+#ifndef PTZTOUR_H
+#define PTZTOUR_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "Metrics.h"
+#include "PtzControl.h"
+
+#define PTZ_TOUR_RECORDS 64     // step records kept for tour status
+#define PTZ_TOUR_SPIN_US 1000   // the last part of a wait is spun, not slept
+
+// Tour file, one step per line, numbered from 0, '#' starts a comment:
+//   preset <slot> [dwell=ms] [next=step] [timeout=ms]
+//   abs <pan> <tilt> [speed=pan[,tilt]] [dwell=ms] [next=step] [timeout=ms]
+// next defaults to the following step; after the last one the tour ends
+// unless it names a next step.
+struct PtzTourStep
+{
+    bool preset;
+    CrInt16u slot;
+    CrInt32 pan;
+    CrInt32 tilt;
+    CrInt32 panSpeed;
+    CrInt32 tiltSpeed;
+    int dwell;              // ms held after the drive completed
+    int next;               // -1 ends the tour
+    int timeout;            // ms the drive may take
+};
+
+struct PtzTourRecord
+{
+    uint64_t seq;           // steps run since the tour started
+    int step;
+    int64_t planned;        // ns after the tour start the step was due
+    int64_t late;           // ns the move went out after it was due
+    int64_t move;           // ns sent to drive completed, or to the failure
+    PtzMoveStatus status;
+};
+
+SCRSDK::CrError ptzTourRead(const std::string& path, std::vector<PtzTourStep>* steps);
+
+// Runs a tour on its own thread. Each step is due on the steady clock at
+// the previous drive's completion plus its dwell, so the next move starts
+// when PresetPTZFEvent DriveCompleted arrives and the dwell is kept, rather
+// than after a worst-case move time. A failed or timed out step is recorded
+// and the tour goes on, a disconnect ends it.
+class PtzTour
+{
+public:
+    PtzTour();
+    ~PtzTour();
+
+    SCRSDK::CrError start(const std::vector<PtzTourStep>& steps);
+    void stop();
+    bool running();
+    // oldest first
+    void records(std::vector<PtzTourRecord>* records);
+
+    LatencyHistogram late;
+    LatencyHistogram move;
+
+private:
+    // wakes the tour when its drive resolves, a drive left behind by
+    // stop() may resolve after the tour is gone
+    struct Waker
+    {
+        std::mutex mutex;
+        PtzTour* tour;
+    };
+
+    void run();
+    // false when stopped
+    bool waitUntil(std::chrono::steady_clock::time_point due);
+    void record(const PtzTourRecord& record);
+
+    std::thread m_thread;
+    std::vector<PtzTourStep> m_steps;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    bool m_running;
+    bool m_stopping;
+    bool m_driving;         // stopped with a drive of the tour still running
+    std::shared_ptr<Waker> m_waker;
+    std::deque<PtzTourRecord> m_records;
+};
+
+extern PtzTour m_ptzTour;
+
+SCRSDK::CrError _ptzTourStart(const std::string& path);
+void _ptzTourStatus();
+
+// ptz_tour_* lines for /metrics
+void writePtzTourMetrics(std::string& out);
+
+#endif // PTZTOUR_H
@@ -0,0 +1,294 @@
+#include "PtzTrajectory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#include "CrDebugString.h"
+#include "DeviceProperty.h"
+#include "PtzControl.h"
+#include "RemoteCli.h"
+
+PtzTrajConfig m_trajConfig = {
+    { 1000, 1000, 1 },
+    { 50, 50, 32767 },
+    { 50000, 50000, 20000 },
+    { 200000, 200000, 80000 },
+    0,
+};
+
+static const CrInt32u m_positionCodes[PTZ_AXES] = {
+    SCRSDK::CrDeviceProperty_PanPositionCurrentValue,
+    SCRSDK::CrDeviceProperty_TiltPositionCurrentValue,
+    SCRSDK::CrDeviceProperty_ZoomPositionCurrentValue,
+};
+
+static const char* m_axisNames[PTZ_AXES] = { "pan", "tilt", "zoom" };
+
+SCurve::SCurve()
+    : m_distance(0)
+{
+    std::fill(m_t, m_t + 8, 0.0);
+    std::fill(m_j, m_j + 7, 0.0);
+    std::fill(m_p, m_p + 8, 0.0);
+    std::fill(m_v, m_v + 8, 0.0);
+    std::fill(m_a, m_a + 8, 0.0);
+}
+
+void SCurve::plan(double distance, double speed, double accel, double jerk)
+{
+    double tj = 0, ta = 0, tv = 0;
+
+    m_distance = distance;
+    if(distance > 0 && speed > 0 && accel > 0 && jerk > 0) {
+        // accelerating phase: jerk up for tj, constant accel, jerk down for tj
+        tj = accel / jerk;
+        if(speed * jerk < accel * accel) { tj = std::sqrt(speed / jerk); ta = 2 * tj; }
+        else ta = tj + speed / accel;
+        // speeding up and slowing down cover speed * ta
+        tv = distance / speed - ta;
+        if(tv < 0) {
+            // too short to cruise, the peak speed is lower
+            double peak = (-accel * accel / jerk + std::sqrt(accel * accel * accel * accel / (jerk * jerk) + 4 * accel * distance)) / 2;
+            tv = 0;
+            if(peak * jerk >= accel * accel) { tj = accel / jerk; ta = tj + peak / accel; }
+            else { tj = std::cbrt(distance / (2 * jerk)); ta = 2 * tj; }
+        }
+    }
+
+    const double durations[7] = { tj, ta - 2 * tj, tj, tv, tj, ta - 2 * tj, tj };
+    const double jerks[7] = { jerk, 0, -jerk, 0, -jerk, 0, jerk };
+    m_t[0] = m_p[0] = m_v[0] = m_a[0] = 0;
+    for(int i = 0; i < 7; i++) {
+        double d = std::max(durations[i], 0.0);
+        m_j[i] = jerks[i];
+        m_t[i + 1] = m_t[i] + d;
+        m_p[i + 1] = m_p[i] + m_v[i] * d + m_a[i] * d * d / 2 + m_j[i] * d * d * d / 6;
+        m_v[i + 1] = m_v[i] + m_a[i] * d + m_j[i] * d * d / 2;
+        m_a[i + 1] = m_a[i] + m_j[i] * d;
+    }
+}
+
+void SCurve::sample(double t, double* pos, double* vel, double* acc) const
+{
+    double p = m_distance, v = 0, a = 0;
+
+    if(t <= 0) {
+        p = 0;
+    } else if(t < m_t[7]) {
+        int i = 0;
+        while(i < 6 && t >= m_t[i + 1]) i++;
+        double d = t - m_t[i];
+        p = m_p[i] + m_v[i] * d + m_a[i] * d * d / 2 + m_j[i] * d * d * d / 6;
+        v = m_v[i] + m_a[i] * d + m_j[i] * d * d / 2;
+        a = m_a[i] + m_j[i] * d;
+    }
+    *pos = p;
+    if(vel) *vel = v;
+    if(acc) *acc = a;
+}
+
+void PtzTrajectory::plan(const double from[PTZ_AXES], const double to[PTZ_AXES], const PtzTrajConfig& conf)
+{
+    // one curve for the path parameter 0..1, the tightest axis sets its limits
+    double speed = HUGE_VAL, accel = HUGE_VAL, jerk = HUGE_VAL;
+    bool moving = false;
+
+    for(int i = 0; i < PTZ_AXES; i++) {
+        double d;
+        m_from[i] = from[i];
+        m_delta[i] = to[i] - from[i];
+        d = std::fabs(m_delta[i]);
+        if(d == 0) continue;
+        moving = true;
+        speed = std::min(speed, conf.step[i] * conf.maxSpeed[i] / d);
+        accel = std::min(accel, conf.accel[i] / d);
+        jerk = std::min(jerk, conf.jerk[i] / d);
+    }
+    if(moving) m_s.plan(1, speed, accel, jerk);
+    else m_s.plan(0, 0, 0, 0);
+}
+
+void PtzTrajectory::sample(double t, double pos[PTZ_AXES], double vel[PTZ_AXES]) const
+{
+    double s, ds;
+    m_s.sample(t, &s, &ds);
+    for(int i = 0; i < PTZ_AXES; i++) {
+        pos[i] = m_from[i] + m_delta[i] * s;
+        if(vel) vel[i] = m_delta[i] * ds;
+    }
+}
+
+void ptzTrajCommands(const PtzTrajectory& traj, const PtzTrajConfig& conf, int rate, std::vector<PtzTrajCommand>* commands)
+{
+    const double dt = 1.0 / rate;
+    const int ticks = (int)std::ceil(traj.duration() * rate);
+    double sent[PTZ_AXES];      // where the commands so far take the head
+    double pos[PTZ_AXES];
+
+    commands->clear();
+    commands->reserve(ticks + 1);
+    traj.sample(0, sent);
+    for(int k = 0; k < ticks; k++) {
+        int speed[PTZ_AXES];
+        // the speed that reaches the plan at the end of this tick
+        traj.sample((k + 1) * dt, pos);
+        for(int i = 0; i < PTZ_AXES; i++) {
+            speed[i] = 0;
+            if(conf.step[i] <= 0) continue;
+            speed[i] = (int)std::lround((pos[i] - sent[i]) / dt / conf.step[i]);
+            speed[i] = std::max(-conf.maxSpeed[i], std::min(conf.maxSpeed[i], speed[i]));
+            sent[i] += speed[i] * conf.step[i] * dt;
+        }
+        commands->push_back({ (CrInt32)speed[PTZ_AXIS_PAN], (CrInt32)speed[PTZ_AXIS_TILT], (CrInt16)speed[PTZ_AXIS_ZOOM] });
+    }
+    commands->push_back({ 0, 0, 0 });
+}
+
+void ptzTrajSimulate(const PtzTrajectory& traj, const std::vector<PtzTrajCommand>& commands, const PtzTrajConfig& conf, int rate,
+    const PtzHeadModel& head, PtzSimResult* result)
+{
+    const double h = 0.0005;    // integration step
+    const double dt = 1.0 / rate;
+    const double limit = commands.size() * dt + head.latency + 10;
+    double pos[PTZ_AXES], vel[PTZ_AXES] = { 0, 0, 0 };
+    double tickVel[PTZ_AXES] = { 0, 0, 0 };     // at the last command period boundary
+    double tick = dt;
+    double plan[PTZ_AXES], end[PTZ_AXES];
+    double t = 0;
+    // the command the head is acting on, none before the latency passed;
+    // the steps end on the command boundaries so no command runs a step long
+    const PtzTrajCommand* cmd = nullptr;
+    size_t next = 0;
+    double change = head.latency;
+
+    traj.sample(0, pos);
+    traj.sample(traj.duration(), end);
+    for(int i = 0; i < PTZ_AXES; i++) result->pathError[i] = result->peakSpeed[i] = result->peakAccel[i] = 0;
+
+    for(;;) {
+        if(next < commands.size() && t >= change) {
+            cmd = &commands[next++];
+            change = head.latency + next * dt;
+        }
+        const int speed[PTZ_AXES] = { cmd ? cmd->pan : 0, cmd ? cmd->tilt : 0, cmd ? cmd->zoom : 0 };
+        const double step = next < commands.size() ? std::min(h, change - t) : h;
+        bool done = next == commands.size();
+
+        for(int i = 0; i < PTZ_AXES; i++) {
+            double want = speed[i] * conf.step[i];
+            double v = want;
+            if(head.accel[i] > 0) v = vel[i] + std::max(-head.accel[i] * step, std::min(head.accel[i] * step, want - vel[i]));
+            pos[i] += (v + vel[i]) / 2 * step;
+            vel[i] = v;
+            if(v != 0) done = false;
+            result->peakSpeed[i] = std::max(result->peakSpeed[i], std::fabs(v));
+        }
+        t = next < commands.size() && change - t <= h ? change : t + step;
+        if(t >= tick) {
+            // over a command period, an instant head would show each step as a spike
+            for(int i = 0; i < PTZ_AXES; i++) {
+                result->peakAccel[i] = std::max(result->peakAccel[i], std::fabs(vel[i] - tickVel[i]) / dt);
+                tickVel[i] = vel[i];
+            }
+            tick += dt;
+        }
+        traj.sample(t - head.latency, plan);
+        for(int i = 0; i < PTZ_AXES; i++) result->pathError[i] = std::max(result->pathError[i], std::fabs(pos[i] - plan[i]));
+        if(done || t > limit) break;
+    }
+    result->duration = t;
+    for(int i = 0; i < PTZ_AXES; i++) result->finalError[i] = end[i] - pos[i];
+}
+
+// PanPositionCurrentValue etc., the values are signed
+static SCRSDK::CrError _readPosition(int64_t device_handle, double pos[PTZ_AXES])
+{
+    for(int i = 0; i < PTZ_AXES; i++) {
+        SCRSDK::CrDeviceProperty prop;
+        SCRSDK::CrError err = _getDeviceProperty(device_handle, m_positionCodes[i], &prop);
+        if(err) return err;
+        pos[i] = prop.GetValueType() == SCRSDK::CrDataType_UInt16 ? (double)(CrInt16u)prop.GetCurrentValue() : (double)(CrInt32)prop.GetCurrentValue();
+    }
+    return 0;
+}
+
+SCRSDK::CrError _ptzTrajectory(int64_t device_handle, const double to[PTZ_AXES], bool zoom)
+{
+    SCRSDK::CrError err = SCRSDK::CrError_Generic_Unknown;
+    const int rate = m_ptz.rate();
+    double from[PTZ_AXES], target[PTZ_AXES], at[PTZ_AXES];
+    PtzTrajectory traj;
+    std::vector<PtzTrajCommand> commands;
+    SCRSDK::CrDeviceProperty ramp;
+    bool restoreRamp = false;
+
+    err = _readPosition(device_handle, from);
+    if(err) GotoError("position", err);
+    std::copy(to, to + PTZ_AXES, target);
+    if(!zoom) target[PTZ_AXIS_ZOOM] = from[PTZ_AXIS_ZOOM];
+    traj.plan(from, target, m_trajConfig);
+    ptzTrajCommands(traj, m_trajConfig, rate, &commands);
+    printf("  %.3fs, %d commands at %d/s\n", traj.duration(), (int)commands.size(), rate);
+
+    // the head's own ramp would round off the profile again, use the one
+    // configured for streaming where the camera has it
+    if(m_trajConfig.rampCurve && !_getDeviceProperty(device_handle, SCRSDK::CrDeviceProperty_PanTiltAccelerationRampCurve, &ramp)
+        && ramp.GetCurrentValue() != (CrInt64u)m_trajConfig.rampCurve) {
+        err = _setDeviceProperty(device_handle, SCRSDK::CrDeviceProperty_PanTiltAccelerationRampCurve, m_trajConfig.rampCurve);
+        if(err) PrintError("ramp curve", err);
+        restoreRamp = !err;
+    }
+
+    {
+        // every tick is sent, a lost one would lose its distance
+        const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        SCRSDK::CrError haltErr;
+        double late = 0;
+        for(size_t k = 0; k < commands.size(); k++) {
+            const std::chrono::steady_clock::time_point due = begin + std::chrono::microseconds((int64_t)k * 1000000 / rate);
+            std::this_thread::sleep_until(due);
+            late = std::max(late, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - due).count());
+            err = m_ptz.stream(commands[k].pan, commands[k].tilt, commands[k].zoom);
+            if(err) {
+                PrintError("stream", err);
+                break;
+            }
+        }
+        haltErr = m_ptz.halt();
+        if(!err) err = haltErr;
+        printf("  streamed in %.3fs, late up to %.1fms\n", std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(), late);
+    }
+
+    if(restoreRamp) _setDeviceProperty(device_handle, SCRSDK::CrDeviceProperty_PanTiltAccelerationRampCurve, ramp.GetCurrentValue());
+    if(err) GotoError("stop", err);
+
+    err = _readPosition(device_handle, at);
+    if(err) GotoError("position", err);
+    for(int i = 0; i < PTZ_AXES; i++) printf("  %s %.0f -> %.0f, error %.0f\n", m_axisNames[i], from[i], at[i], target[i] - at[i]);
+Error:
+    return err;
+}
+
+void _ptzTrajectorySim(const double to[PTZ_AXES], double latency_ms, double head_accel)
+{
+    const double from[PTZ_AXES] = { 0, 0, 0 };
+    const int rate = m_ptz.rate();
+    const PtzHeadModel head = { latency_ms / 1000, { head_accel, head_accel, 0 } };
+    PtzTrajectory traj;
+    std::vector<PtzTrajCommand> commands;
+    PtzSimResult res;
+
+    traj.plan(from, to, m_trajConfig);
+    ptzTrajCommands(traj, m_trajConfig, rate, &commands);
+    ptzTrajSimulate(traj, commands, m_trajConfig, rate, head, &res);
+
+    printf("  plan %.3fs, %d commands at %d/s, head still after %.3fs\n", traj.duration(), (int)commands.size(), rate, res.duration);
+    for(int i = 0; i < PTZ_AXES; i++) {
+        if(to[i] == 0) continue;
+        printf("  %-4s error %.1f, off path %.1f, peak speed %.0f/s accel %.0f/s^2\n", m_axisNames[i],
+            res.finalError[i], res.pathError[i], res.peakSpeed[i], res.peakAccel[i]);
+    }
+}
@@ -0,0 +1,104 @@
+/* eased pan/tilt/zoom moves streamed as direction commands */
+
+#ifndef PTZTRAJECTORY_H
+#define PTZTRAJECTORY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+
+enum { PTZ_AXIS_PAN, PTZ_AXIS_TILT, PTZ_AXIS_ZOOM, PTZ_AXES };
+
+#define PTZ_ZOOM_SPEED_MAX 32767    // ZoomOperationWithInt16 is a CrInt16
+
+// Per axis, in the camera's position units (PanPositionCurrentValue etc.).
+// step is how far one direction/zoom speed step moves the head in a
+// second; it depends on the model and is best measured.
+struct PtzTrajConfig
+{
+    double step[PTZ_AXES];      // units/s per speed step
+    int maxSpeed[PTZ_AXES];     // highest direction / ZoomOperationWithInt16 speed used
+    double accel[PTZ_AXES];     // units/s^2
+    double jerk[PTZ_AXES];      // units/s^3
+    int rampCurve;              // PanTiltAccelerationRampCurve while streaming, 0 leaves it
+};
+
+extern PtzTrajConfig m_trajConfig;
+
+// Rest to rest jerk-limited (S-curve) profile over a distance: jerk up,
+// constant acceleration, jerk down, cruise and the mirror image. Phases
+// the limits do not allow for are left out.
+class SCurve
+{
+public:
+    SCurve();
+
+    void plan(double distance, double speed, double accel, double jerk);
+    double duration() const { return m_t[7]; }
+    void sample(double t, double* pos, double* vel = nullptr, double* acc = nullptr) const;
+
+private:
+    double m_distance;
+    double m_t[8];          // segment start times, m_t[7] is the end
+    double m_j[7];
+    double m_p[8];          // state at the segment starts
+    double m_v[8];
+    double m_a[8];
+};
+
+// All axes follow one S-curve along the straight line from start to target,
+// so they start and arrive together and each stays inside its own limits.
+class PtzTrajectory
+{
+public:
+    void plan(const double from[PTZ_AXES], const double to[PTZ_AXES], const PtzTrajConfig& conf);
+    double duration() const { return m_s.duration(); }
+    void sample(double t, double pos[PTZ_AXES], double vel[PTZ_AXES] = nullptr) const;
+
+private:
+    SCurve m_s;
+    double m_from[PTZ_AXES];
+    double m_delta[PTZ_AXES];
+};
+
+struct PtzTrajCommand
+{
+    CrInt32 pan;
+    CrInt32 tilt;
+    CrInt16 zoom;
+};
+
+// One command per 1/rate s; the last one stops. Speeds are rounded with the
+// error carried to the next tick, so the sum of the commands lands on the
+// target rather than drifting by a rounding error each tick.
+void ptzTrajCommands(const PtzTrajectory& traj, const PtzTrajConfig& conf, int rate, std::vector<PtzTrajCommand>* commands);
+
+// A head that applies each command latency s after it was sent and ramps
+// its speed towards it at no more than accel units/s^2 (0 at once).
+struct PtzHeadModel
+{
+    double latency;
+    double accel[PTZ_AXES];
+};
+
+struct PtzSimResult
+{
+    double duration;                // until the head stood still
+    double finalError[PTZ_AXES];    // target - where it stopped
+    double pathError[PTZ_AXES];     // largest distance from the delayed plan
+    double peakSpeed[PTZ_AXES];
+    double peakAccel[PTZ_AXES];     // speed change over one command period
+};
+
+void ptzTrajSimulate(const PtzTrajectory& traj, const std::vector<PtzTrajCommand>& commands, const PtzTrajConfig& conf, int rate,
+    const PtzHeadModel& head, PtzSimResult* result);
+
+// Reads the head's position, streams the profile to the target with
+// m_ptz.stream() at m_ptz's rate and reads the position again. Zoom only
+// moves when zoom is true.
+SCRSDK::CrError _ptzTrajectory(int64_t device_handle, const double to[PTZ_AXES], bool zoom);
+// Plans from 0 to the target and runs it on a PtzHeadModel, no camera needed.
+void _ptzTrajectorySim(const double to[PTZ_AXES], double latency_ms, double head_accel);
+
+#endif // PTZTRAJECTORY_H
@@ -1,10 +1,12 @@
 // "get live view with http and ptz" sample
 #include "httplib.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cinttypes>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <future>
 #include <iostream>
@@ -46,17 +48,26 @@
 #include "CRSDK/CrDeviceProperty.h"
 #include "CRSDK/CameraRemote_SDK.h"
 #include "CRSDK/IDeviceCallback.h"
-#include "CrDebugString.h"   // use CrDebugString.cpp
-
-#define PrintError(msg, err) { fprintf(stderr, "Error in %s(%d):" msg ",%s\n", __FUNCTION__, __LINE__, (err ? CrErrorString(err).c_str():"")); }
-#define GotoError(msg, err) { PrintError(msg, err); goto Error; }
+#include "RemoteCli.h"
+#include "LiveView.h"
+#include "LiveViewHttp.h"
+#include "Metrics.h"
+#include "PropertyCache.h"
+#include "PropertyEvents.h"
+#include "PropertyValues.h"
+#include "DeviceProperty.h"
+#include "DeviceEvents.h"
+#include "Snapshot.h"
+#include "PtzApi.h"
+#include "PtzControl.h"
+#include "PtzTour.h"
+#include "PtzTrajectory.h"
 
 bool  m_connected = false;
 std::string m_modelId;
 int64_t  m_device_handle = 0;
 
 std::mutex m_eventPromiseMutex;
-uint32_t m_setDPCode = 0;
 std::promise<void>* m_eventPromise = nullptr;
 void setEventPromise(std::promise<void>* dp)
 {
@@ -64,113 +75,90 @@ void setEventPromise(std::promise<void>* dp)
     m_eventPromise = dp;
 }
 
-std::promise<void>* m_lvPromise = nullptr;
-std::mutex m_lvPromiseMutex;
-void setLvPromise(std::promise<void>* dp)
+// On the property worker thread
+static void _propertiesChanged(std::vector<CrInt32u>& codes, bool resync)
 {
-    std::lock_guard<std::mutex> lock(m_lvPromiseMutex);
-    m_lvPromise = dp;
-}
-
-SCRSDK::CrError _getDeviceProperty(int64_t device_handle, uint32_t code, SCRSDK::CrDeviceProperty* devProp)
-{
-    std::int32_t nprop = 0;
-    SCRSDK::CrDeviceProperty* prop_list = nullptr;
-    SCRSDK::CrError err = SCRSDK::GetSelectDeviceProperties(device_handle, 1, &code, &prop_list, &nprop);
-    if(err) GotoError("", err);
-    if(prop_list && nprop >= 1) {
-        *devProp = prop_list[0];
+    if(resync) {
+        m_propCache.load(m_device_handle);
+        m_propCache.codes(&codes);
+    } else {
+        // refresh first so a waiter woken below already reads the new value
+        m_propCache.refresh(m_device_handle, (CrInt32u)codes.size(), codes.data());
     }
-Error:
-    if(prop_list) SCRSDK::ReleaseDeviceProperties(device_handle, prop_list);
-    return err;
-}
-
-SCRSDK::CrError _setDeviceProperty(int64_t device_handle, uint32_t code, uint64_t data, bool blocking=true)
-{
-    int result = SCRSDK::CrError_Generic_Unknown;
-    SCRSDK::CrError err = 0;
-    std::promise<void> eventPromise;
-    std::future<void> eventFuture = eventPromise.get_future();
-    std::future_status status;
-
-    SCRSDK::CrDeviceProperty devProp;
-
-    err = _getDeviceProperty(device_handle, code, &devProp);
-    if(err) GotoError("", err);
-    if (devProp.GetValueType() == SCRSDK::CrDataType_STR) GotoError("STR is not supported", 0);
-    if (blocking && devProp.GetCurrentValue() == data) {
-        std::cout << "skipped\n";
-        return 0;
-    }
-
-    if(blocking) {
-        std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
-        m_setDPCode = code;
-        m_eventPromise = &eventPromise;
-    }
-
-    devProp.SetCurrentValue(data);
-    err = SCRSDK::SetDeviceProperty(device_handle, &devProp);
-    if(err) GotoError("", err);
-
-    if(!blocking) return 0;
-
-    status = eventFuture.wait_for(std::chrono::milliseconds(3000));
-    if(status != std::future_status::ready) GotoError("timeout", 0);
-
-    try{
-        eventFuture.get();
-    } catch(const std::exception&) GotoError("", 0);
-    std::cout << "OK\n";
-
-    result = 0;
-Error:
-    setEventPromise(nullptr);
-    return result;
+    propertyChanged((CrInt32u)codes.size(), codes.data());
+    propertyEventsPublish((CrInt32u)codes.size(), codes.data());
 }
 
-std::vector<int64_t> _getPossible(SCRSDK::CrDeviceProperty* devProp)
+// Runs on the dispatcher thread, the sdk callbacks below only queue events.
+// Nothing here waits for the camera, property refreshes go to m_propertyWorker.
+static void _handleDeviceEvents(std::vector<DeviceEvent>& events)
 {
-/*
-    CrInt32u GetSetValueSize();
-    CrInt8u* GetSetValues();
-*/
-    SCRSDK::CrDataType dataType = devProp->GetValueType();
-    std::vector<int64_t> possible;
-
-    int dataLen = 1;
-    switch(dataType & 0x100F) {
-    case SCRSDK::CrDataType_UInt8:  dataLen = sizeof(uint8_t); break;
-    case SCRSDK::CrDataType_Int8:   dataLen = sizeof(int8_t); break;
-    case SCRSDK::CrDataType_UInt16: dataLen = sizeof(uint16_t); break;
-    case SCRSDK::CrDataType_Int16:  dataLen = sizeof(int16_t); break;
-    case SCRSDK::CrDataType_UInt32: dataLen = sizeof(uint32_t); break;
-    case SCRSDK::CrDataType_Int32:  dataLen = sizeof(int32_t); break;
-    case SCRSDK::CrDataType_UInt64: dataLen = sizeof(uint64_t); break;
-    default: return possible;
-    }
-
-    unsigned char const* buf = devProp->GetValues();
-    uint32_t nval = devProp->GetValueSize() / dataLen;
-    possible.resize(nval);
-    for (uint32_t i = 0; i < nval; ++i) {
-        int64_t data = 0;
-        switch(dataType & 0x100F) {
-        case SCRSDK::CrDataType_UInt8:  data = (reinterpret_cast<uint8_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_Int8:   data = (reinterpret_cast<int8_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_UInt16: data = (reinterpret_cast<uint16_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_Int16:  data = (reinterpret_cast<int16_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_UInt32: data = (reinterpret_cast<uint32_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_Int32:  data = (reinterpret_cast<int32_t const*>(buf))[i]; break;
-        case SCRSDK::CrDataType_UInt64: data = (reinterpret_cast<uint64_t const*>(buf))[i]; break;
-        default: break;
+    for(DeviceEvent& event : events) {
+        switch(event.type) {
+        case DeviceEvent_MonitorUpdated:
+            if(event.param1 == SCRSDK::CrMonitorUpdated_LiveView) m_liveView.notify(event.value);
+            break;
+        case DeviceEvent_PropertyChanged:
+            m_propertyWorker.changed(event.num, event.codes);
+            break;
+        case DeviceEvent_Resync:
+            m_propertyWorker.resync();
+            break;
+        case DeviceEvent_LvPropertyChanged:
+            m_liveView.session().invalidateImageInfo();
+            break;
+        case DeviceEvent_Connected:
+            std::cout << "Connected to " << m_modelId << "\n";
+            m_connected = true;
+            {
+                std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
+                if(m_eventPromise) {
+                    m_eventPromise->set_value();
+                    m_eventPromise = nullptr;
+                }
+            }
+            break;
+        case DeviceEvent_Error:
+            printf("Connection error:%s\n", CrErrorString(event.value).c_str());
+            {
+                std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
+                if(m_eventPromise) {
+                    m_eventPromise->set_exception(std::make_exception_ptr(std::runtime_error("error")));
+                    m_eventPromise = nullptr;
+                }
+            }
+            break;
+        case DeviceEvent_Disconnected:
+            std::cout << "Disconnected from " << m_modelId << "\n";
+            m_connected = false;
+            // properties may change while we are away, misses refetch them
+            m_propCache.clear();
+            propertyWaitersAbort(SCRSDK::CrError_Connect_Disconnected);
+            m_ptz.abortMoves(SCRSDK::CrError_Connect_Disconnected);
+            {
+                std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
+                if(m_eventPromise) {
+                    m_eventPromise->set_value();
+                    m_eventPromise = nullptr;
+                }
+            }
+            break;
+        case DeviceEvent_Warning:
+            if(event.value == SCRSDK::CrWarning_Connect_Reconnecting) {
+                std::cout << "Reconnecting to " << m_modelId << "\n";
+            }
+            break;
+        case DeviceEvent_WarningExt:
+            m_ptz.warningExt(event.value, event.param1, event.param2, event.param3);
+            break;
+        default:
+            break;
         }
-        possible.at(i) = data;
     }
-    return possible;
 }
 
+// Every callback copies its arguments into a DeviceEvent and returns, the
+// work is done in _handleDeviceEvents.
 class DeviceCallback : public SCRSDK::IDeviceCallback
 {
 public:
@@ -179,34 +167,20 @@ public:
 
     void OnConnected(SCRSDK::DeviceConnectionVersioin version)
     {
-        std::cout << "Connected to " << m_modelId << "\n";
-        m_connected = true;
-        std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
-        if(m_eventPromise) {
-            m_eventPromise->set_value();
-            m_eventPromise = nullptr;
-        }
+        CallbackDwell dwell(DeviceEvent_Connected);
+        m_deviceEvents.push(DeviceEvent_Connected);
     }
 
     void OnError(CrInt32u error)
     {
-        printf("Connection error:%s\n", CrErrorString(error).c_str());
-        std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
-        if(m_eventPromise) {
-            m_eventPromise->set_exception(std::make_exception_ptr(std::runtime_error("error")));
-            m_eventPromise = nullptr;
-        }
+        CallbackDwell dwell(DeviceEvent_Error);
+        m_deviceEvents.push(DeviceEvent_Error, error);
     }
 
     void OnDisconnected(CrInt32u error)
     {
-        std::cout << "Disconnected from " << m_modelId << "\n";
-        m_connected = false;
-        std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
-        if(m_eventPromise) {
-            m_eventPromise->set_value();
-            m_eventPromise = nullptr;
-        }
+        CallbackDwell dwell(DeviceEvent_Disconnected);
+        m_deviceEvents.push(DeviceEvent_Disconnected, error);
     }
 
     void OnCompleteDownload(CrChar* filename, CrInt32u type )
@@ -221,122 +195,74 @@ public:
 
     void OnWarning(CrInt32u warning)
     {
-        if (warning == SCRSDK::CrWarning_Connect_Reconnecting) {
-            std::cout << "Reconnecting to " << m_modelId << "\n";
-            return;
-        }
+        CallbackDwell dwell(DeviceEvent_Warning);
+        m_deviceEvents.push(DeviceEvent_Warning, warning);
     }
 
-    void OnWarningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2, CrInt32 param3) {}
+    void OnWarningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2, CrInt32 param3)
+    {
+        CallbackDwell dwell(DeviceEvent_WarningExt);
+        DeviceEvent event;
+        event.type = DeviceEvent_WarningExt;
+        event.value = warning;
+        event.param1 = param1;
+        event.param2 = param2;
+        event.param3 = param3;
+        event.num = 0;
+        m_deviceEvents.push(event);
+    }
     void OnLvPropertyChanged() {}
-    void OnLvPropertyChangedCodes(CrInt32u num, CrInt32u* codes) {}
+    void OnLvPropertyChangedCodes(CrInt32u num, CrInt32u* codes)
+    {
+        CallbackDwell dwell(DeviceEvent_LvPropertyChanged);
+        m_deviceEvents.pushCodes(DeviceEvent_LvPropertyChanged, num, codes);
+    }
     void OnPropertyChanged() {}
     void OnPropertyChangedCodes(CrInt32u num, CrInt32u* codes)
     {
-        //std::cout << "OnPropertyChangedCodes:\n";
-        for(uint32_t i = 0; i < num; ++i) {
-            std::lock_guard<std::mutex> lock(m_eventPromiseMutex);
-            if(m_setDPCode && m_setDPCode == codes[i]) {
-                m_setDPCode = 0;
-                if(m_eventPromise) {
-                    m_eventPromise->set_value();
-                    m_eventPromise = nullptr;
-                }
-            }
-/*
-            std::string name = CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)codes[i]);
-
-            SCRSDK::CrDeviceProperty devProp;
-            SCRSDK::CrError err = _getDeviceProperty(m_device_handle, codes[i], &devProp);
-            if(err) break;
-            if(devProp.GetValueType() == SCRSDK::CrDataType_STR) {
-                CrCout << "  " << CrString(name.begin(), name.end()) << "=\"" << _getCurrentStr(&devProp) << "\"\n";
-            } else {
-                int64_t current = devProp.GetCurrentValue();
-                if(current < 10) {
-                    printf("  %s=%" PRId64 "\n", name.c_str(), current);
-                } else {
-                    printf("  %s=0x%" PRIx64 "(%" PRId64 ")\n", name.c_str(), current, current);
-                }
-            }
-*/
-        }
+        CallbackDwell dwell(DeviceEvent_PropertyChanged);
+        m_deviceEvents.pushCodes(DeviceEvent_PropertyChanged, num, codes);
     }
     void OnNotifyMonitorUpdated(CrInt32u type, CrInt32u frameNo)
     {
-        if(type == SCRSDK::CrMonitorUpdated_LiveView) {
-    //  printf("%x", frameNo & 0xF);
-            std::lock_guard<std::mutex> lock(m_lvPromiseMutex);
-            if(m_lvPromise) {
-                m_lvPromise->set_value();
-                m_lvPromise = nullptr;
-            }
-        }
+        CallbackDwell dwell(DeviceEvent_MonitorUpdated);
+        DeviceEvent event;
+        event.type = DeviceEvent_MonitorUpdated;
+        event.value = frameNo;
+        event.param1 = (CrInt32)type;
+        event.param2 = event.param3 = 0;
+        event.num = 0;
+        m_deviceEvents.push(event);
     }
 
 };
 
-SCRSDK::CrError _getLiveView(int64_t device_handle, CrString path)
+SCRSDK::CrError _saveLiveView(CrString path, const CrInt8u* image, CrInt32u size)
 {
     int result = SCRSDK::CrError_Generic_Unknown;
-    SCRSDK::CrError err = 0;
-    CrInt32 num = 0;
-    SCRSDK::CrLiveViewProperty* property = nullptr;
-    SCRSDK::CrImageInfo imageInfo;
-    SCRSDK::CrImageDataBlock image_data;
-    CrInt32u bufSize = 0;
-    CrInt8u* image_buff = nullptr;
-
-    err = SCRSDK::GetLiveViewProperties(device_handle, &property, &num);  if(err) GotoError("", err);
-    SCRSDK::ReleaseLiveViewProperties(device_handle, property);
-
-    err = SCRSDK::GetLiveViewImageInfo(device_handle, &imageInfo);  if(err) GotoError("", err);
-    bufSize = imageInfo.GetBufferSize();
-    if (bufSize <= 0) GotoError("", 0);
-
-    image_buff = new CrInt8u[bufSize];
-    if (!image_buff) GotoError("", 0);
-
-    image_data.SetData(image_buff);
-    image_data.SetSize(bufSize);
-
-    err = SCRSDK::GetLiveViewImage(device_handle, &image_data);  if(err) GotoError("", err);
-    if (image_data.GetSize() <= 0) GotoError("", 0);
 
+    path.append(DELIMITER CRSTR("LiveView000000.JPG"));
     {
-        path.append(DELIMITER CRSTR("LiveView000000.JPG"));
         std::ofstream file(path, std::ios::out | std::ios::binary);
         if (file.bad()) GotoError("", 0);
-        file.write((char*)image_data.GetImageData(), image_data.GetImageSize());
+        file.write((const char*)image, size);
         file.close();
         CrCout << path.data() << '\n';
     }
     result = 0;
 Error:
-    if(image_buff) delete[] image_buff;
     return result;
 }
 
-//-------------------------------
-
-#include <atomic>
-
-std::atomic<bool> running(true);
-
-SCRSDK::CrError _getLiveView2(int64_t device_handle, CrInt8u** lv_image, CrInt32u* lv_size)
+SCRSDK::CrError _getLiveView(int64_t device_handle, CrString path)
 {
     int result = SCRSDK::CrError_Generic_Unknown;
     SCRSDK::CrError err = 0;
-    CrInt32 num = 0;
-    SCRSDK::CrLiveViewProperty* property = nullptr;
     SCRSDK::CrImageInfo imageInfo;
     SCRSDK::CrImageDataBlock image_data;
     CrInt32u bufSize = 0;
     CrInt8u* image_buff = nullptr;
 
-    err = SCRSDK::GetLiveViewProperties(device_handle, &property, &num);  if(err) GotoError("", err);
-    SCRSDK::ReleaseLiveViewProperties(device_handle, property);
-
     err = SCRSDK::GetLiveViewImageInfo(device_handle, &imageInfo);  if(err) GotoError("", err);
     bufSize = imageInfo.GetBufferSize();
     if (bufSize <= 0) GotoError("", 0);
@@ -350,69 +276,49 @@ SCRSDK::CrError _getLiveView2(int64_t device_handle, CrInt8u** lv_image, CrInt32
     err = SCRSDK::GetLiveViewImage(device_handle, &image_data);  if(err) GotoError("", err);
     if (image_data.GetSize() <= 0) GotoError("", 0);
 
-    *lv_size = image_data.GetImageSize();
-    *lv_image = new CrInt8u[*lv_size];
-    if(!*lv_image) GotoError("", 0);
-    memcpy(*lv_image, image_data.GetImageData(), *lv_size);
+    err = _saveLiveView(path, image_data.GetImageData(), image_data.GetImageSize());  if(err) goto Error;
     result = 0;
 Error:
     if(image_buff) delete[] image_buff;
     return result;
 }
 
-bool streamLiveview(size_t offset, httplib::DataSink &sink)
+// with the server running the capture thread owns live view, which may be off
+SCRSDK::CrError _getSharedLiveView(CrString path)
 {
-    bool result = false;
-    SCRSDK::CrError err = 0;
-    CrInt8u* image_buff = nullptr;
-    CrInt32u bufSize = 0;
-
-    std::promise<void> lvPromise;
-    std::future<void> lvFuture = lvPromise.get_future();
-    std::future_status status;
-
-    setLvPromise(&lvPromise);
-    status = lvFuture.wait_for(std::chrono::milliseconds(3000));
-    if(status != std::future_status::ready) GotoError("timeout", 0);
-    try{
-        lvFuture.get();
-    } catch(const std::exception&) GotoError("", 0);
-
-    err = _getLiveView2(m_device_handle, &image_buff, &bufSize);
-    if(err) return false;
-
-    {
-        char buf[256] = {0};
-        int len = snprintf(buf, sizeof(buf), "--frame\r\n"
-                                            "Content-Type: image/jpeg\r\n"
-                                            "Content-Length: %d\r\n\r\n", bufSize);
-        if(len >= sizeof(buf)) GotoError("", 0);
-        sink.write(buf, len);
-    }
-    sink.write((char*)image_buff, bufSize);
-    sink.write("\r\n", 2);
+    int result = SCRSDK::CrError_Generic_Unknown;
+    LvViewer viewer;
+    uint64_t lastSeq = 0;
+    LvFrameRef frame = m_liveView.latest(&lastSeq);
 
-    //std::this_thread::sleep_for(std::chrono::milliseconds(33));
-    result = true;
+    if(!m_liveView.waitNext(frame, lastSeq, LV_FIRST_FRAME_TIMEOUT)) GotoError("timeout", 0);
+    result = _saveLiveView(path, frame->image, frame->size);
 Error:
-    setLvPromise(nullptr);
-    delete[] image_buff;
-    image_buff = nullptr;
     return result;
 }
 
-void handle_request(const httplib::Request& req, httplib::Response& res)
-{
-    res.set_header("Access-Control-Allow-Origin", "*");
-    res.set_chunked_content_provider(
-        "multipart/x-mixed-replace; boundary=frame", streamLiveview
-    );
-}
+//-------------------------------
+
+#include <atomic>
+
+std::atomic<bool> running(true);
 
 void server_thread(httplib::Server& svr)
 {
     std::cout << "please access to http://localhost:8080\n";
-    svr.Get("/", handle_request);
+    // every mjpeg viewer keeps one worker thread for the life of its stream
+    svr.new_task_queue = [] { return new httplib::ThreadPool(LV_MAX_CLIENTS); };
+    svr.Get("/", handle_liveview);
+    svr.Get("/snapshot.jpg", handle_snapshot);
+    svr.Get("/events", handle_events);
+    addMetricsSource(writeLiveViewMetrics);
+    addMetricsSource(writePropertyCacheMetrics);
+    addMetricsSource(writeDevicePropertyMetrics);
+    addMetricsSource(writePropertyEventMetrics);
+    addMetricsSource(writeDeviceEventMetrics);
+    addMetricsSource(writePtzMetrics);
+    addMetricsSource(writePtzTourMetrics);
+    svr.Get("/metrics", handle_metrics);
     svr.listen("0.0.0.0", 8080);
     running = false;
 }
@@ -467,6 +373,8 @@ int main(void)
 
     bool boolRet = SCRSDK::Init();
     if(!boolRet) GotoError("", 0);
+    m_propertyWorker.start(_propertiesChanged);
+    m_deviceEvents.start(_handleDeviceEvents);
 
     {
         std::string inputLine;
@@ -535,6 +443,12 @@ int main(void)
 
     std::this_thread::sleep_for(std::chrono::milliseconds(1000));
 
+    // fill the property cache in one request
+    err = m_propCache.load(m_device_handle);
+    if(err) PrintError("property cache", err);
+
+    ptzf_attach(m_device_handle);
+
     // set LiveViewProtocol=2(http)
     err = _setDeviceProperty(m_device_handle, SCRSDK::CrDeviceProperty_LiveViewProtocol, 2/*http*/);
     if(err) goto Error;
@@ -543,11 +457,25 @@ int main(void)
 //  std::cout << "   p <1(Main),2(httpLV)> - set live view protocol\n";
     std::cout << "   l                     - get live view\n";
     std::cout << "   s                     - streaming liveview \n";
+    std::cout << "   clients               - list streaming clients\n";
+    std::cout << "   lvconf [maxfps|maxage|grace] [value] - show/set streaming config (fps 0-120, ms)\n";
+    std::cout << "   evconf [window] [value] - show/set /events coalescing window (0-15000 ms)\n";
     std::cout << "   pt <1(abs),2(rel),3(dir),4(home)> [pan] [tilt] [p-speed] [t-speed] - control ptz \n";
+    std::cout << "   ptw <1(abs),2(rel),4(home)> [pan] [tilt] [p-speed] [t-speed] [timeout] - control ptz, wait until done\n";
+    std::cout << "   zoom <-32767~32767>   - zoom speed, 0 stops\n";
+    std::cout << "   ptzconf [rate] [value] - show/set ptz commands per second\n";
     std::cout << "   setp <1~100>          - set preset\n";
+    std::cout << "   tour <start <file>|stop|status> - run a preset tour\n";
+    std::cout << "   traj <pan> <tilt> [zoom] - eased move to a position\n";
+    std::cout << "   traj sim <pan> <tilt> [zoom] [latency ms] [head accel] - run it on a simulated head\n";
+    std::cout << "   trajconf [<pan|tilt|zoom>_<step|max|accel|jerk>|ramp] [value] - show/set eased move config\n";
     std::cout << "   set <DP name> <param>\n";
     std::cout << "   get <DP name>\n";
+    std::cout << "   setm <DP name> <param> [<DP name> <param>...] - set in one batch\n";
+    std::cout << "   getm <DP name> [DP name...] - get in one request\n";
     std::cout << "   info <DP name>\n";
+    std::cout << "   snapshot <save|diff|apply> <file> - save/compare/restore all properties\n";
+    std::cout << "   stats                 - set to acknowledge latency per property, ptz counters\n";
     std::cout << "   send <command name> <param> [param]\n";
     std::cout << "To exit, please enter 'q'.\n";
 
@@ -565,33 +493,102 @@ int main(void)
             if(err) goto Error;
 */
         } else if(args[0] == "l" || args[0] == "L") {
-            err = _getLiveView(m_device_handle, path);
+            if(serverThread) err = _getSharedLiveView(path);
+            else err = _getLiveView(m_device_handle, path);
             if(err) goto Error;
 
         } else if(args[0] == "s" || args[0] == "S") {
             if(!serverThread) {
+                m_liveView.start(m_device_handle);
                 serverThread = new std::thread(server_thread, std::ref(svr));
             }
         } else if(args[0] == "pt" && args.size() >= 2) {
-            #define SPEED_MAX 50 // 127
+            // direction is coalesced, everything else pre-empts it
+            err = controlPTZF(inputLine.c_str() + args[0].size());
+            if(err == SCRSDK::CrError_Generic_InvalidParameter) GotoError("invalid input", 0);
+            if(err) GotoError("", err);
 
-            uint32_t type = 0;
+        } else if(args[0] == "ptw" && args.size() >= 2) {
+            // type, pan, tilt, pan speed, tilt speed, timeout
+            int64_t values[6] = { 0, 0, 0, PTZF_SPEED_DEFAULT, PTZF_SPEED_DEFAULT, PTZ_MOVE_TIMEOUT };
             SCRSDK::CrPTZFSetting ptzfSetting;
+            size_t i = 1;
+            for(; i < args.size() && i <= 6; i++) {
+                try { values[i - 1] = _stoll(args[i]); } catch(const std::exception&) { break; }
+            }
+            if(i < args.size()) { std::cout << "invalid input\n"; continue; }
+
             ptzfSetting.pan.exists = 1;
-            ptzfSetting.pan.position = 0;
-            ptzfSetting.pan.speed = SPEED_MAX;
+            ptzfSetting.pan.position = (CrInt32)values[1];
+            ptzfSetting.pan.speed = (CrInt32)values[3];
             ptzfSetting.tilt.exists = 1;
-            ptzfSetting.tilt.position = 0;
-            ptzfSetting.tilt.speed = SPEED_MAX;
-
-            try { type = stoi(args[1]); } catch(const std::exception&) { GotoError("", 0); }
-            if(args.size() >= 3) try { ptzfSetting.pan.position = (int)_stoll(args[2]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-            if(args.size() >= 4) try { ptzfSetting.tilt.position = (int)_stoll(args[3]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-            if(args.size() >= 5) try { ptzfSetting.pan.speed= (int)_stoll(args[4]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-            if(args.size() >= 6) try { ptzfSetting.tilt.speed= (int)_stoll(args[5]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-
-            err = SCRSDK::ControlPTZF(m_device_handle, (SCRSDK::CrPTZFControlType)type, &ptzfSetting);
-            if(err) GotoError("", err);
+            ptzfSetting.tilt.position = (CrInt32)values[2];
+            ptzfSetting.tilt.speed = (CrInt32)values[4];
+            PtzMoveResult res = m_ptz.moveAsync((SCRSDK::CrPTZFControlType)values[0], &ptzfSetting, (int)values[5]).get();
+            printf("  %s%s%s %.1fms\n", ptzMoveStatusString(res.status), res.err ? " " : "",
+                res.err ? CrErrorString(res.err).c_str() : "", res.ns / 1e6);
+
+        } else if(args[0] == "zoom" && args.size() >= 2) {
+            int64_t speed = 0;
+            try { speed = _stoll(args[1]); } catch(const std::exception&) { std::cout << "invalid input\n"; continue; }
+            if(ptzf_zoom((int32_t)speed)) std::cout << "invalid input\n";
+
+        } else if(args[0] == "ptzconf") {
+            if(args.size() >= 3) {
+                int64_t data = 0;
+                try{ data = _stoll(args[2]); } catch(const std::exception&) {continue;}
+                if(args[1] == "rate" && data > 0) m_ptz.setRate((int)data);
+                else { std::cout << "unknown config\n"; continue; }
+            }
+            printf("  rate=%d\n", m_ptz.rate());
+
+        } else if(args[0] == "tour" && args.size() >= 2) {
+            if(args[1] == "start" && args.size() >= 3) _ptzTourStart(args[2]);
+            else if(args[1] == "stop") m_ptzTour.stop();
+            else if(args[1] == "status") _ptzTourStatus();
+            else std::cout << "unknown tour command\n";
+
+        } else if(args[0] == "traj" && args.size() >= 3) {
+            // target pan, tilt, zoom, then for sim latency and head accel
+            bool sim = args[1] == "sim";
+            double values[5] = { 0, 0, 0, 0, 0 };
+            size_t first = sim ? 2 : 1;
+            size_t i = first;
+            for(; i < args.size() && i - first < (sim ? 5u : 3u); i++) {
+                try { values[i - first] = std::stod(args[i]); } catch(const std::exception&) { break; }
+            }
+            if(i < args.size() || i - first < 2) { std::cout << "invalid input\n"; continue; }
+            if(sim) _ptzTrajectorySim(values, values[3], values[4]);
+            else _ptzTrajectory(m_device_handle, values, i - first >= 3);
+
+        } else if(args[0] == "trajconf") {
+            if(args.size() >= 3) {
+                static const char* axes[PTZ_AXES] = { "pan_", "tilt_", "zoom_" };
+                double data = 0;
+                bool known = false;
+                try { data = std::stod(args[2]); } catch(const std::exception&) { continue; }
+                if(args[1] == "ramp") { m_trajConfig.rampCurve = (int)data; known = true; }
+                for(int a = 0; a < PTZ_AXES && !known; a++) {
+                    if(args[1].compare(0, strlen(axes[a]), axes[a])) continue;
+                    std::string field = args[1].substr(strlen(axes[a]));
+                    known = true;
+                    if(data <= 0) known = false;
+                    else if(field == "step") m_trajConfig.step[a] = data;
+                    else if(field == "max") {
+                        // the zoom speed is sent as a CrInt16, pan and tilt as CrInt32
+                        m_trajConfig.maxSpeed[a] = (int)std::min(data, a == PTZ_AXIS_ZOOM ? PTZ_ZOOM_SPEED_MAX : (double)INT32_MAX);
+                    }
+                    else if(field == "accel") m_trajConfig.accel[a] = data;
+                    else if(field == "jerk") m_trajConfig.jerk[a] = data;
+                    else known = false;
+                }
+                if(!known) { std::cout << "unknown config\n"; continue; }
+            }
+            for(int a = 0; a < PTZ_AXES; a++) {
+                printf("  %s step=%g max=%d accel=%g jerk=%g\n", a == PTZ_AXIS_PAN ? "pan " : a == PTZ_AXIS_TILT ? "tilt" : "zoom",
+                    m_trajConfig.step[a], m_trajConfig.maxSpeed[a], m_trajConfig.accel[a], m_trajConfig.jerk[a]);
+            }
+            printf("  ramp=%d\n", m_trajConfig.rampCurve);
 
         } else if(args[0] == "setp" && args.size() >= 2) {
             int index = 0;
@@ -600,6 +597,51 @@ int main(void)
             if(err) GotoError("", err);
             std::cout << "OK\n";
 
+        } else if(args[0] == "clients") {
+            std::vector<MjpegClientStats> clients = getMjpegClients();
+            for(MjpegClientStats& client : clients) {
+                printf("  %d %s fps=%.1f(max %d) bytes/s=%.0f frames=%" PRIu64 " dropped=%" PRIu64 "\n",
+                    client.id, client.addr.c_str(), client.fps, client.maxFps, client.bytesPerSec, client.frames, client.dropped);
+            }
+            printf("  %d clients\n", (int)clients.size());
+            {
+                LvStats lv = m_liveView.stats();
+                printf("  live view %s, %d viewers, time to first frame %.1fms\n",
+                    lv.enabled ? "on" : "off", lv.viewers, lv.firstFrameMs);
+            }
+            std::vector<PropertyEventClientStats> eventClients = getPropertyEventClients();
+            for(PropertyEventClientStats& client : eventClients) {
+                printf("  %d %s events=%" PRIu64 " coalesced=%" PRIu64 " window=%dms codes=%s\n",
+                    client.id, client.addr.c_str(), client.events, client.coalesced, client.window,
+                    client.codes ? std::to_string(client.codes).c_str() : "all");
+            }
+            printf("  %d event clients\n", (int)eventClients.size());
+
+        } else if(args[0] == "evconf") {
+            if(args.size() >= 3) {
+                int64_t data = 0;
+                try{ data = _stoll(args[2]); } catch(const std::exception&) {continue;}
+                if(args[1] == "window" && data >= 0 && data <= PROP_EVENT_KEEPALIVE) m_propEventConfig.window = (int)data;
+                else { std::cout << "unknown config\n"; continue; }
+            }
+            printf("  window=%d\n", m_propEventConfig.window.load());
+
+        } else if(args[0] == "lvconf") {
+            if(args.size() >= 3) {
+                int64_t data = 0;
+                try{ data = _stoll(args[2]); } catch(const std::exception&) {continue;}
+                if(args[1] == "maxfps" && data >= 0 && data <= LV_MAX_FPS) m_lvHttpConfig.maxFps = (int)data;
+                else if(args[1] == "maxage" && data > 0 && data <= LV_MAX_AGE) m_lvHttpConfig.snapshotMaxAge = (int)data;
+                else if(args[1] == "grace" && data >= -1 && data <= LV_IDLE_GRACE_MAX) m_liveView.setIdleGrace((int)data);
+                else {
+                    printf("  maxfps 0-%d (0:camera rate), maxage 1-%d ms, grace 0-%d ms (-1:never)\n", LV_MAX_FPS, LV_MAX_AGE, LV_IDLE_GRACE_MAX);
+                    continue;
+                }
+            }
+            printf("  maxfps=%d\n", m_lvHttpConfig.maxFps.load());
+            printf("  maxage=%d\n", m_lvHttpConfig.snapshotMaxAge.load());
+            printf("  grace=%d\n", m_liveView.idleGrace());
+
         } else if(args[0] == "q" || args[0] == "Q") {
             break;
         } else if(args[0] == "send" && args.size() >= 3) {
@@ -629,39 +671,114 @@ int main(void)
             err = _setDeviceProperty(m_device_handle, code, data, false/*blocking*/);
             if(err) continue;
 
+        } else if(args[0] == "setm" && args.size() >= 3) {
+            std::vector<PropertyValue> values;
+            std::vector<PropertyResult> results;
+            for(size_t i = 1; i + 1 < args.size(); i += 2) {
+                PropertyValue value;
+                int32_t code = CrDevicePropertyCode(args[i]);
+                if(code < 0) break;
+                try{ value.value = _stoll(args[i + 1]); } catch(const std::exception&) { break; }
+                value.code = code;
+                values.push_back(value);
+            }
+            if(values.size() != (args.size() - 1) / 2) { std::cout << "invalid input\n"; continue; }
+
+            _setDeviceProperties(m_device_handle, values, &results);
+            for(PropertyResult& res : results) {
+                printf("  %s=%s\n", CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)res.code).c_str(),
+                    res.skipped ? "skipped" : res.err ? CrErrorString(res.err).c_str() : "OK");
+            }
+
+        } else if(args[0] == "stats") {
+            std::vector<PropertySetStats> stats;
+            getPropertySetStats(&stats);
+            for(PropertySetStats& stat : stats) {
+                printf("  %s sets=%" PRIu64 " acks=%" PRIu64 " p50=%.1fms p99=%.1fms max=%.1fms timeouts=%" PRIu64 " late=%" PRIu64 " errors=%" PRIu64 "\n",
+                    CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)stat.code).c_str(), stat.sets, stat.acks,
+                    stat.p50 / 1e6, stat.p99 / 1e6, stat.max / 1e6, stat.timeouts, stat.late, stat.errors);
+            }
+            printf("  %d properties\n", (int)stats.size());
+            {
+                PtzStats ptz = m_ptz.stats();
+                printf("  ptz sent=%" PRIu64 " coalesced=%" PRIu64 " preempted=%" PRIu64 " rate=%d\n",
+                    ptz.sent, ptz.coalesced, ptz.preempted, ptz.rate);
+            }
+
+        } else if(args[0] == "snapshot" && args.size() >= 3) {
+            if(args[1] == "save") _snapshotSave(m_device_handle, args[2]);
+            else if(args[1] == "diff") _snapshotDiff(m_device_handle, args[2]);
+            else if(args[1] == "apply") _snapshotApply(m_device_handle, args[2]);
+            else std::cout << "unknown snapshot command\n";
+
+        } else if(args[0] == "getm" && args.size() >= 2) {
+            std::vector<CrInt32u> codes;
+            std::vector<PropertyEntry> entries;
+            for(size_t i = 1; i < args.size(); i++) {
+                int32_t code = CrDevicePropertyCode(args[i]);
+                if(code >= 0) codes.push_back(code);
+            }
+            if(codes.empty()) continue;
+
+            err = _getDeviceProperties(m_device_handle, codes, &entries);
+            if(err) { PrintError("", err); continue; }
+            for(PropertyEntry& entry : entries) {
+                std::string name = CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)entry.code);
+                if(!entry.valid) printf("  %s not supported\n", name.c_str());
+                else printf("  %s=0x%" PRIx64 "(%" PRId64 ")\n", name.c_str(), entry.current, entry.current);
+            }
+
         } else if((args[0] == "get" || args[0] == "info") && args.size() >= 2) {
         // device property get/info
             int32_t code = CrDevicePropertyCode(args[1]);
             if(code < 0) continue;
 
-            SCRSDK::CrDeviceProperty devProp;
-            err = _getDeviceProperty(m_device_handle, code, &devProp);
+            PropertyEntry prop;
+            err = _getCachedProperty(m_device_handle, code, &prop);
             if(err) continue;
-            SCRSDK::CrDataType dataType = devProp.GetValueType();
+            SCRSDK::CrDataType dataType = (SCRSDK::CrDataType)prop.valueType;
 
             if(args[0] == "get") {
                 if(dataType == SCRSDK::CrDataType_STR) {
-                    //CrCout << _getCurrentStr(&devProp) << "\n";
+                    std::string str;
+                    m_propCache.getString(code, &str);
+                    printf("\"%s\"\n", str.c_str());
                 } else {
-                    printf("0x%" PRIx64 "(%" PRId64 ")\n", devProp.GetCurrentValue(), devProp.GetCurrentValue());  // macro for %lld
+                    printf("0x%" PRIx64 "(%" PRId64 ")\n", prop.current, prop.current);  // macro for %lld
                 }
             } else if(args[0] == "info") {
-                printf("  get enable=%d\n", devProp.IsGetEnableCurrentValue());
-                printf("  set enable=%d\n", devProp.IsSetEnableCurrentValue());
-                printf("  variable  =%d\n", devProp.GetPropertyVariableFlag());
-                printf("  enable    =%d\n", devProp.GetPropertyEnableFlag());
+                printf("  get enable=%d\n", prop.getEnable);
+                printf("  set enable=%d\n", prop.setEnable);
+                printf("  variable  =%d\n", prop.variableFlag);
+                printf("  enable    =%d\n", prop.enableFlag);
                 printf("  valueType =0x%x\n", dataType);
                 if(dataType == SCRSDK::CrDataType_STR) {
-                    //CrCout << "  current   =\"" << _getCurrentStr(&devProp) << "\"\n";
+                    std::string str;
+                    m_propCache.getString(code, &str);
+                    printf("  current   =\"%s\"\n", str.c_str());
                 } else {
-                    printf("  current   =0x%" PRIx64 "(%" PRId64 ")\n", devProp.GetCurrentValue(), devProp.GetCurrentValue());
-
-                    std::vector<int64_t> possible = _getPossible(&devProp);
-                    printf("  possible  =");
-                    for(int i = 0; i < possible.size(); i++) {
-                        printf("0x%" PRIx64 "(%" PRId64 "),", possible[i], possible[i]);
+                    printf("  current   =0x%" PRIx64 "(%" PRId64 ")\n", prop.current, prop.current);
+
+                    std::vector<CrInt8u> values;
+                    std::vector<int64_t> possible;
+                    m_propCache.getValues(code, &values);
+                    decodePropertyValues(dataType, values.data(), values.size(), &possible);
+                    switch(propertyValueForm(dataType)) {
+                    case PropertyValueForm_Range:
+                        if(possible.size() >= 3) {
+                            printf("  range     =0x%" PRIx64 "(%" PRId64 ")..0x%" PRIx64 "(%" PRId64 ") step %" PRId64 "\n",
+                                possible[0], possible[0], possible[1], possible[1], possible[2]);
+                            break;
+                        }
+                        // fall through
+                    default:
+                        printf("  %s  =", propertyValueForm(dataType) == PropertyValueForm_Array ? "elements" : "possible");
+                        for(size_t i = 0; i < possible.size(); i++) {
+                            printf("0x%" PRIx64 "(%" PRId64 "),", possible[i], possible[i]);
+                        }
+                        printf("\n");
+                        break;
                     }
-                    printf("\n");
                 }
             }
         } else {
@@ -672,10 +789,14 @@ int main(void)
     result = 0;
 Error:
     if(serverThread) {
+        propertyEventsClose();
         svr.stop();
         while(running);
         serverThread->join();
     }
+    m_liveView.stop();
+    m_ptzTour.stop();
+    ptzf_detach();
     if(enumCameraObjectInfo) enumCameraObjectInfo->Release();
 
     if(m_connected) {
@@ -685,6 +806,8 @@ Error:
         SCRSDK::Disconnect(m_device_handle);
         eventFuture.wait_for(std::chrono::milliseconds(3000));
     }
+    m_deviceEvents.stop();
+    m_propertyWorker.stop();
     if(m_device_handle) SCRSDK::ReleaseDevice(m_device_handle);
     SCRSDK::Release();
 
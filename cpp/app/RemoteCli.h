@@ -0,0 +1,20 @@
+/* definitions shared by RemoteCli modules */
+
+#ifndef REMOTECLI_H
+#define REMOTECLI_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "CrDebugString.h"   // use CrDebugString.cpp
+
+#define PrintError(msg, err) { fprintf(stderr, "Error in %s(%d):" msg ",%s\n", __FUNCTION__, __LINE__, (err ? CrErrorString(err).c_str():"")); }
+#define GotoError(msg, err) { PrintError(msg, err); goto Error; }
+
+extern bool  m_connected;
+extern std::string m_modelId;
+extern int64_t  m_device_handle;
+
+#endif // REMOTECLI_H
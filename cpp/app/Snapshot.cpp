@@ -0,0 +1,290 @@
+#include "Snapshot.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "DeviceProperty.h"
+#include "PropertyCache.h"
+#include "RemoteCli.h"
+
+#define SNAPSHOT_STAGES 3
+
+// Restore order, everything not listed goes into the last stage.
+static const struct { CrInt32u code; int stage; } m_stages[] = {
+    // what the camera records decides the ranges of nearly everything else
+    { SCRSDK::CrDeviceProperty_ExposureCtrlType, 0 },
+    { SCRSDK::CrDeviceProperty_Movie_Recording_Setting, 0 },
+    { SCRSDK::CrDeviceProperty_Movie_Recording_FrameRateSetting, 0 },
+    { SCRSDK::CrDeviceProperty_ImagerScanMode, 0 },
+    { SCRSDK::CrDeviceProperty_APS_C_or_Full_SwitchingSetting, 0 },
+    { SCRSDK::CrDeviceProperty_MovieShootingMode, 0 },
+    { SCRSDK::CrDeviceProperty_LogShootingMode, 0 },
+    // modes that make the values after them settable
+    { SCRSDK::CrDeviceProperty_ExposureProgramMode, 1 },
+    { SCRSDK::CrDeviceProperty_IrisModeSetting, 1 },
+    { SCRSDK::CrDeviceProperty_ShutterModeSetting, 1 },
+    { SCRSDK::CrDeviceProperty_ShutterMode, 1 },
+    { SCRSDK::CrDeviceProperty_ShutterSetting, 1 },
+    { SCRSDK::CrDeviceProperty_GainControlSetting, 1 },
+    { SCRSDK::CrDeviceProperty_GainUnitSetting, 1 },
+    { SCRSDK::CrDeviceProperty_NDFilterModeSetting, 1 },
+    { SCRSDK::CrDeviceProperty_NDPresetOrVariableSwitchingSetting, 1 },
+    { SCRSDK::CrDeviceProperty_FocusMode, 1 },
+    { SCRSDK::CrDeviceProperty_FocusModeSetting, 1 },
+    { SCRSDK::CrDeviceProperty_WhiteBalance, 1 },
+    { SCRSDK::CrDeviceProperty_WhiteBalanceModeSetting, 1 },
+    { SCRSDK::CrDeviceProperty_IsoAutoMinShutterSpeedMode, 1 },
+    { SCRSDK::CrDeviceProperty_DriveMode, 1 },
+};
+
+// Operations and connection state, setting them again acts instead of restoring.
+static const CrInt32u m_excluded[] = {
+    SCRSDK::CrDeviceProperty_SdkControlMode,
+    SCRSDK::CrDeviceProperty_CameraOperatingMode,
+    SCRSDK::CrDeviceProperty_DateTime_Settings,
+    SCRSDK::CrDeviceProperty_Zoom_Operation,
+    SCRSDK::CrDeviceProperty_ZoomOperationWithInt16,
+    SCRSDK::CrDeviceProperty_Focus_Operation,
+    SCRSDK::CrDeviceProperty_FocusOperationWithInt16,
+    SCRSDK::CrDeviceProperty_PushAutoFocus,
+    SCRSDK::CrDeviceProperty_PushAutoIris,
+    SCRSDK::CrDeviceProperty_PushAutoNDFilter,
+    SCRSDK::CrDeviceProperty_PushAGC,
+    SCRSDK::CrDeviceProperty_CustomWB_Capture_Operation,
+    SCRSDK::CrDeviceProperty_CustomWB_Capture_Standby_Cancel,
+    SCRSDK::CrDeviceProperty_RemoteTouchOperation,
+    SCRSDK::CrDeviceProperty_TouchOperation,
+    SCRSDK::CrDeviceProperty_MovieRecReviewButton,
+    SCRSDK::CrDeviceProperty_MoviePlayButton,
+    SCRSDK::CrDeviceProperty_MoviePlayPauseButton,
+    SCRSDK::CrDeviceProperty_MoviePlayStopButton,
+    SCRSDK::CrDeviceProperty_MovieForwardButton,
+    SCRSDK::CrDeviceProperty_MovieRewindButton,
+    SCRSDK::CrDeviceProperty_MovieNextButton,
+    SCRSDK::CrDeviceProperty_MoviePrevButton,
+    SCRSDK::CrDeviceProperty_RemoteKeySLOTSelectButton,
+    SCRSDK::CrDeviceProperty_RemoteKeyThumbnailButton,
+};
+
+static int _stageOf(CrInt32u code)
+{
+    for(auto& stage : m_stages) {
+        if(stage.code == code) return stage.stage;
+    }
+    return SNAPSHOT_STAGES - 1;
+}
+
+static bool _isExcluded(CrInt32u code)
+{
+    for(CrInt32u excluded : m_excluded) {
+        if(excluded == code) return true;
+    }
+    return false;
+}
+
+static void _put(std::vector<CrInt8u>& buf, uint64_t value, int bytes)
+{
+    for(int i = 0; i < bytes; i++) buf.push_back((CrInt8u)(value >> (i * 8)));
+}
+
+static uint64_t _get(const CrInt8u* p, int bytes)
+{
+    uint64_t value = 0;
+    for(int i = 0; i < bytes; i++) value |= (uint64_t)p[i] << (i * 8);
+    return value;
+}
+
+SCRSDK::CrError snapshotWrite(const std::string& path, const std::vector<SnapshotEntry>& entries)
+{
+    SCRSDK::CrError result = SCRSDK::CrError_Generic_Unknown;
+    std::vector<CrInt8u> buf;
+
+    buf.reserve(12 + entries.size() * SNAPSHOT_ENTRY_SIZE);
+    buf.insert(buf.end(), SNAPSHOT_MAGIC, SNAPSHOT_MAGIC + 4);
+    _put(buf, SNAPSHOT_VERSION, 2);
+    _put(buf, SNAPSHOT_ENTRY_SIZE, 2);
+    _put(buf, entries.size(), 4);
+    for(const SnapshotEntry& entry : entries) {
+        _put(buf, entry.code, 2);
+        _put(buf, entry.valueType, 2);
+        _put(buf, entry.setEnable ? SNAPSHOT_SETTABLE : 0, 1);
+        _put(buf, entry.value, 8);
+    }
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary);
+        if(!file) GotoError("can not open", 0);
+        file.write((const char*)buf.data(), buf.size());
+        if(!file) GotoError("can not write", 0);
+    }
+    result = 0;
+Error:
+    return result;
+}
+
+SCRSDK::CrError snapshotRead(const std::string& path, std::vector<SnapshotEntry>* entries)
+{
+    SCRSDK::CrError result = SCRSDK::CrError_Generic_Unknown;
+    std::vector<CrInt8u> buf;
+    size_t entrySize = 0;
+    size_t count = 0;
+
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if(!file) GotoError("can not open", 0);
+        buf.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    if(buf.size() < 12 || memcmp(buf.data(), SNAPSHOT_MAGIC, 4)) GotoError("not a snapshot", 0);
+    if(_get(&buf[4], 2) != SNAPSHOT_VERSION) GotoError("unknown version", 0);
+    entrySize = (size_t)_get(&buf[6], 2);
+    count = (size_t)_get(&buf[8], 4);
+    if(entrySize < SNAPSHOT_ENTRY_SIZE || buf.size() < 12 + count * entrySize) GotoError("truncated", 0);
+
+    entries->resize(count);
+    for(size_t i = 0; i < count; i++) {
+        const CrInt8u* p = &buf[12 + i * entrySize];
+        SnapshotEntry& entry = entries->at(i);
+        entry.code = (CrInt32u)_get(p, 2);
+        entry.valueType = (CrInt32u)_get(p + 2, 2);
+        entry.setEnable = (p[4] & SNAPSHOT_SETTABLE) != 0;
+        entry.value = _get(p + 5, 8);
+    }
+    result = 0;
+Error:
+    return result;
+}
+
+// Live state of the snapshot's codes in stage, all of them for -1, read
+// from the camera: the cache is refreshed by change events that may not
+// have come in yet. Codes the camera no longer has are left invalid.
+static SCRSDK::CrError _liveState(int64_t device_handle, const std::vector<SnapshotEntry>& snapshot, int stage, std::vector<PropertyEntry>* live)
+{
+    std::vector<CrInt32u> codes;
+
+    live->assign(snapshot.size(), PropertyEntry());
+    for(const SnapshotEntry& entry : snapshot) {
+        if(stage < 0 || _stageOf(entry.code) == stage) codes.push_back(entry.code);
+    }
+    if(codes.empty()) return 0;
+
+    SCRSDK::CrError err = m_propCache.refresh(device_handle, (CrInt32u)codes.size(), codes.data());
+    if(err) return err;
+    for(size_t i = 0; i < snapshot.size(); i++) {
+        if(stage < 0 || _stageOf(snapshot[i].code) == stage) m_propCache.get(snapshot[i].code, &live->at(i));
+    }
+    return 0;
+}
+
+SCRSDK::CrError _snapshotSave(int64_t device_handle, const std::string& path)
+{
+    SCRSDK::CrError err = 0;
+    std::vector<CrInt32u> codes;
+    std::vector<SnapshotEntry> entries;
+
+    // one GetDeviceProperties, it refreshes the cache as well
+    err = m_propCache.load(device_handle);
+    if(err) GotoError("", err);
+    m_propCache.codes(&codes);
+    for(CrInt32u code : codes) {
+        PropertyEntry prop;
+        if(!m_propCache.get(code, &prop) || !prop.getEnable) continue;
+        if(prop.valueType == SCRSDK::CrDataType_STR) continue;
+        entries.push_back({ code, prop.valueType, prop.current, prop.setEnable });
+    }
+
+    err = snapshotWrite(path, entries);
+    if(err) goto Error;
+    printf("  %d properties saved\n", (int)entries.size());
+Error:
+    return err;
+}
+
+SCRSDK::CrError _snapshotDiff(int64_t device_handle, const std::string& path)
+{
+    SCRSDK::CrError err = 0;
+    std::vector<SnapshotEntry> snapshot;
+    std::vector<PropertyEntry> live;
+    int differ = 0, missing = 0;
+
+    err = snapshotRead(path, &snapshot);
+    if(err) goto Error;
+    err = _liveState(device_handle, snapshot, -1, &live);
+    if(err) GotoError("", err);
+
+    for(size_t i = 0; i < snapshot.size(); i++) {
+        std::string name = CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)snapshot[i].code);
+        if(!live[i].valid) {
+            printf("  %s not on camera\n", name.c_str());
+            missing++;
+        } else if(live[i].current != snapshot[i].value) {
+            printf("  %s snapshot=0x%" PRIx64 "(%" PRId64 ") camera=0x%" PRIx64 "(%" PRId64 ")%s\n", name.c_str(),
+                snapshot[i].value, snapshot[i].value, live[i].current, live[i].current,
+                snapshot[i].setEnable ? "" : " read only");
+            differ++;
+        }
+    }
+    printf("  %d differ, %d equal, %d missing\n", differ, (int)snapshot.size() - differ - missing, missing);
+Error:
+    return err;
+}
+
+SCRSDK::CrError _snapshotApply(int64_t device_handle, const std::string& path, int timeout_ms)
+{
+    SCRSDK::CrError result = 0;
+    SCRSDK::CrError err = 0;
+    std::vector<SnapshotEntry> snapshot;
+    std::vector<PropertyEntry> live;
+    int applied = 0, failed = 0, notSettable = 0, unchanged = 0;
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+    err = snapshotRead(path, &snapshot);
+    if(err) return err;
+
+    for(int stage = 0; stage < SNAPSHOT_STAGES; stage++) {
+        std::vector<PropertyValue> values;
+        std::vector<PropertyResult> results;
+
+        // read again for every stage, the modes set before may have changed
+        // what is settable and what the values are
+        err = _liveState(device_handle, snapshot, stage, &live);
+        if(err) GotoError("", err);
+        for(size_t i = 0; i < snapshot.size(); i++) {
+            const SnapshotEntry& entry = snapshot[i];
+            if(_stageOf(entry.code) != stage) continue;
+            if(!entry.setEnable || _isExcluded(entry.code) || !live[i].valid) continue;
+            if(live[i].current == entry.value) {
+                unchanged++;
+                continue;
+            }
+            if(!live[i].setEnable) {
+                printf("  %s not settable now\n", CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)entry.code).c_str());
+                notSettable++;
+                continue;
+            }
+            values.push_back({ entry.code, entry.value });
+        }
+        if(values.empty()) continue;
+
+        _setDeviceProperties(device_handle, values, &results, timeout_ms);
+        for(PropertyResult& res : results) {
+            if(res.skipped) {
+                unchanged++;
+            } else if(res.err) {
+                printf("  %s %s\n", CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)res.code).c_str(),
+                    res.err == SCRSDK::CrError_Connect_TimeOut ? "timeout" : CrErrorString(res.err).c_str());
+                if(!result) result = res.err;
+                failed++;
+            } else {
+                applied++;
+            }
+        }
+    }
+
+    printf("  %d applied, %d failed, %d not settable, %d unchanged in %.1fms\n", applied, failed, notSettable, unchanged,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count());
+    return result;
+Error:
+    return err;
+}
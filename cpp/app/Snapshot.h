@@ -0,0 +1,42 @@
+/* whole-camera property snapshots: save, diff and restore */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+
+// File layout, little endian:
+//   "CRPS" u16 version u16 entry size u32 count
+//   count * { u16 code, u16 valueType, u8 flags, u64 value }
+#define SNAPSHOT_MAGIC "CRPS"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_ENTRY_SIZE 13
+#define SNAPSHOT_SETTABLE 0x01
+
+struct SnapshotEntry
+{
+    CrInt32u code;
+    CrInt32u valueType;     // SCRSDK::CrDataType
+    CrInt64u value;
+    bool setEnable;         // when saved
+};
+
+SCRSDK::CrError snapshotWrite(const std::string& path, const std::vector<SnapshotEntry>& entries);
+SCRSDK::CrError snapshotRead(const std::string& path, std::vector<SnapshotEntry>* entries);
+
+// Every readable property from one GetDeviceProperties. STR values can not
+// be set again and are left out.
+SCRSDK::CrError _snapshotSave(int64_t device_handle, const std::string& path);
+// prints the properties where the camera differs from the file
+SCRSDK::CrError _snapshotDiff(int64_t device_handle, const std::string& path);
+// Sets the differing settable properties. Modes go first in their own stages
+// (exposure control, then program/iris/shutter/gain/focus/wb modes), since
+// they decide what the values after them may be. Within a stage all sets
+// are in flight at once.
+SCRSDK::CrError _snapshotApply(int64_t device_handle, const std::string& path, int timeout_ms = 3000);
+
+#endif // SNAPSHOT_H
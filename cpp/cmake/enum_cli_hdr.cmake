@@ -4,7 +4,28 @@ set(__cli_hdr_dir ${CMAKE_CURRENT_SOURCE_DIR}/app)
 ### Enumerate RemoteCli header files ###
 message("[${PROJECT_NAME}] Indexing header files..")
 set(__cli_hdrs
+    ${__cli_hdr_dir}/RemoteCli.h
+    ${__cli_hdr_dir}/LiveView.h
+    ${__cli_hdr_dir}/LiveViewHttp.h
+    ${__cli_hdr_dir}/Metrics.h
+    ${__cli_hdr_dir}/PropertyCache.h
+    ${__cli_hdr_dir}/DeviceProperty.h
+    ${__cli_hdr_dir}/PropertyValues.h
+    ${__cli_hdr_dir}/PropertyEvents.h
+    ${__cli_hdr_dir}/DeviceEvents.h
+    ${__cli_hdr_dir}/Snapshot.h
+    ${__cli_hdr_dir}/PtzControl.h
+    ${__cli_hdr_dir}/PtzApi.h
+    ${__cli_hdr_dir}/PtzTour.h
+    ${__cli_hdr_dir}/PtzTrajectory.h
 )
 
 ## Use cli_srcs in project CMakeLists
 set(cli_hdrs ${__cli_hdrs})
+
+### PTZ control shared library headers ###
+set(ptz_hdrs
+    ${__cli_hdr_dir}/PtzApi.h
+    ${__cli_hdr_dir}/PtzControl.h
+    ${__cli_hdr_dir}/Metrics.h
+)
@@ -6,7 +6,28 @@ message("[${PROJECT_NAME}] Indexing source files..")
 set(__cli_srcs
     ${__cli_src_dir}/RemoteCli.cpp
     ${__cli_src_dir}/CrDebugString.cpp
+    ${__cli_src_dir}/LiveView.cpp
+    ${__cli_src_dir}/LiveViewHttp.cpp
+    ${__cli_src_dir}/Metrics.cpp
+    ${__cli_src_dir}/PropertyCache.cpp
+    ${__cli_src_dir}/DeviceProperty.cpp
+    ${__cli_src_dir}/PropertyValues.cpp
+    ${__cli_src_dir}/PropertyEvents.cpp
+    ${__cli_src_dir}/DeviceEvents.cpp
+    ${__cli_src_dir}/Snapshot.cpp
+    ${__cli_src_dir}/PtzControl.cpp
+    ${__cli_src_dir}/PtzApi.cpp
+    ${__cli_src_dir}/PtzTour.cpp
+    ${__cli_src_dir}/PtzTrajectory.cpp
 )
 
 ## Use cli_srcs in project CMakeLists
 set(cli_srcs ${__cli_srcs})
+
+### PTZ control shared library sources ###
+set(ptz_srcs
+    ${__cli_src_dir}/PtzApi.cpp
+    ${__cli_src_dir}/PtzControl.cpp
+    ${__cli_src_dir}/Metrics.cpp
+    ${__cli_src_dir}/CrDebugString.cpp
+)
@@ -0,0 +1,87 @@
+// Every name CrDebugString knows maps back to its code, and how lookups in
+// the sorted tables compare with the unordered_map and linear name search
+// they replaced, rebuilt here from the same pairs.
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CrDebugString.h"
+#include "TestCheck.h"
+
+#define ROUNDS 20
+
+struct CodeName
+{
+    CrInt32 code;
+    std::string name;
+};
+
+// the codes 0..0xffff a lookup knows
+template<typename Fn>
+static void known(Fn toString, std::vector<CodeName>* pairs)
+{
+    for(CrInt32 code = 0; code <= 0xffff; code++) {
+        std::string name = toString(code);
+        if(name.compare(0, 8, "unknown(")) pairs->push_back({ code, name });
+    }
+}
+
+// ns per call of fn over every pair
+template<typename Fn>
+static double timeLookups(const std::vector<CodeName>& pairs, Fn fn)
+{
+    volatile CrInt64 sink = 0;
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for(int r = 0; r < ROUNDS; r++) {
+        for(const CodeName& pair : pairs) sink = sink + fn(pair);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / ((double)ROUNDS * pairs.size());
+}
+
+template<typename ToString, typename ToCode>
+static void table(const char* what, ToString toString, ToCode toCode)
+{
+    std::vector<CodeName> pairs;
+    known(toString, &pairs);
+    CHECK(pairs.size() > 10);
+
+    for(const CodeName& pair : pairs) CHECK_EQ(toCode(pair.name), pair.code);
+    CHECK_EQ(toCode("no such name"), -1);
+
+    // what the tables replaced, a copy of the name out like getMapString
+    // and a walk of the whole map from a name
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    std::unordered_map<CrInt32, std::string> map;
+    for(const CodeName& pair : pairs) map[pair.code] = pair.name;
+    double build = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+    auto mapCode = [&map](const std::string& name) -> CrInt32 {
+        for(auto& entry : map) {
+            if(entry.second == name) return entry.first;
+        }
+        return -1;
+    };
+
+    double mapString = timeLookups(pairs, [&map](const CodeName& pair) { return (CrInt64)std::string(map.find(pair.code)->second).size(); });
+    double tableString = timeLookups(pairs, [&](const CodeName& pair) { return (CrInt64)toString(pair.code).size(); });
+    double mapName = timeLookups(pairs, [&](const CodeName& pair) { return (CrInt64)mapCode(pair.name); });
+    double tableName = timeLookups(pairs, [&](const CodeName& pair) { return (CrInt64)toCode(pair.name); });
+
+    printf("%s, %d names          unordered_map   sorted table\n", what, (int)pairs.size());
+    printf("  build               %10.1fus   none\n", build);
+    printf("  code -> name        %10.1fns   %10.1fns\n", mapString, tableString);
+    printf("  name -> code        %10.1fns   %10.1fns\n", mapName, tableName);
+}
+
+int main()
+{
+    table("properties",
+        [](CrInt32 code) { return CrDevicePropertyString((SCRSDK::CrDevicePropertyCode)code); },
+        [](const std::string& name) { return (CrInt32)CrDevicePropertyCode(name); });
+    table("commands",
+        [](CrInt32 code) { return CrCommandIdString((SCRSDK::CrCommandId)code); },
+        [](const std::string& name) { return (CrInt32)CrCommandIdCode(name); });
+    return m_testFailures ? 1 : 0;
+}
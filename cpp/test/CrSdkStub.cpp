@@ -0,0 +1,320 @@
+// The SDK classes keep their state private and only the SDK may fill them,
+// so the stub, which is the SDK here, opens them up for this file.
+#define private public
+#include "CRSDK/CameraRemote_SDK.h"
+#include "CRSDK/IDeviceCallback.h"
+#undef private
+
+#include "CrSdkStub.h"
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace SCRSDK;
+
+CrSdkStub m_sdkStub;
+
+static std::mutex m_stubMutex;
+static std::map<CrInt32u, CrInt64u> m_values;
+static std::vector<CrInt32u> m_setCodes;
+static std::vector<std::pair<CrInt32, CrInt32>> m_directions;
+static std::vector<CrInt16> m_zooms;
+static std::vector<std::thread> m_threads;
+
+// fn on a thread of its own after ms, joined by Disconnect
+static void _later(int ms, std::function<void()> fn)
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    m_threads.emplace_back([ms, fn] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        fn();
+    });
+}
+
+void CrSdkStub::reset()
+{
+    setDelayMs = 30;
+    setEvents = true;
+    setError = 0;
+    ptzDelayMs = 50;
+    sets = 0;
+    selects = 0;
+    ptzCalls = 0;
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    m_setCodes.clear();
+    m_directions.clear();
+    m_zooms.clear();
+}
+
+void CrSdkStub::setValue(CrInt32u code, CrInt64u value)
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    m_values[code] = value;
+}
+
+CrInt64u CrSdkStub::value(CrInt32u code)
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    return m_values[code];
+}
+
+void CrSdkStub::change(CrInt32u code, CrInt64u value)
+{
+    setValue(code, value);
+    callback->OnPropertyChangedCodes(1, &code);
+}
+
+void CrSdkStub::remove(CrInt32u code)
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    m_values.erase(code);
+}
+
+std::vector<CrInt32u> CrSdkStub::setCodes()
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    return m_setCodes;
+}
+
+std::vector<std::pair<CrInt32, CrInt32>> CrSdkStub::directions()
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    return m_directions;
+}
+
+std::vector<CrInt16> CrSdkStub::zooms()
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    return m_zooms;
+}
+
+namespace SCRSDK {
+
+CrImageInfo::CrImageInfo() : width(640), height(480), bufferSize(0) {}
+CrImageInfo::~CrImageInfo() {}
+CrInt32u CrImageInfo::GetBufferSize() const { return bufferSize; }
+
+CrImageDataBlock::CrImageDataBlock() : frameNo(0), size(0), pData(nullptr), imageSize(0), timeCode(0) {}
+CrImageDataBlock::~CrImageDataBlock() {}
+CrInt32u CrImageDataBlock::GetFrameNo() const { return frameNo; }
+void CrImageDataBlock::SetSize(CrInt32u s) { size = s; }
+CrInt32u CrImageDataBlock::GetSize() const { return size; }
+void CrImageDataBlock::SetData(CrInt8u* d) { pData = d; }
+CrInt32u CrImageDataBlock::GetImageSize() const { return imageSize; }
+CrInt8u* CrImageDataBlock::GetImageData() const { return pData; }
+CrInt32u CrImageDataBlock::GetTimeCode() const { return timeCode; }
+
+CrDeviceProperty::CrDeviceProperty()
+    : code(0), valueType(CrDataType_UInt16), enableFlag(CrEnableValue_True), variableFlag(CrPropertyVariableFlag(1))
+    , currentValue(0), currentStr(nullptr), valuesSize(0), values(nullptr), getSetValuesSize(0), getSetValues(nullptr) {}
+CrDeviceProperty::~CrDeviceProperty() {}
+CrDeviceProperty::CrDeviceProperty(const CrDeviceProperty& r) { *this = r; }
+CrDeviceProperty& CrDeviceProperty::operator=(const CrDeviceProperty& r) { std::memcpy((void*)this, &r, sizeof(*this)); return *this; }
+bool CrDeviceProperty::IsGetEnableCurrentValue() const { return true; }
+bool CrDeviceProperty::IsSetEnableCurrentValue() const { return true; }
+void CrDeviceProperty::SetCode(CrInt32u c) { code = c; }
+CrInt32u CrDeviceProperty::GetCode() const { return code; }
+void CrDeviceProperty::SetValueType(CrDataType t) { valueType = t; }
+CrDataType CrDeviceProperty::GetValueType() const { return valueType; }
+CrPropertyEnableFlag CrDeviceProperty::GetPropertyEnableFlag() const { return enableFlag; }
+CrPropertyVariableFlag CrDeviceProperty::GetPropertyVariableFlag() const { return variableFlag; }
+void CrDeviceProperty::SetCurrentValue(CrInt64u v) { currentValue = v; }
+CrInt64u CrDeviceProperty::GetCurrentValue() const { return currentValue; }
+CrInt16u* CrDeviceProperty::GetCurrentStr() const { return currentStr; }
+CrInt32u CrDeviceProperty::GetValueSize() const { return valuesSize; }
+CrInt8u* CrDeviceProperty::GetValues() const { return values; }
+CrInt32u CrDeviceProperty::GetSetValueSize() const { return getSetValuesSize; }
+CrInt8u* CrDeviceProperty::GetSetValues() const { return getSetValues; }
+
+CrLiveViewProperty::CrLiveViewProperty() : code(0), enableFlag(CrEnableValue_True), valueType(CrFrameInfoType(0)), valueSize(0), value(nullptr), timeCode(0) {}
+CrLiveViewProperty::~CrLiveViewProperty() {}
+CrLiveViewProperty::CrLiveViewProperty(const CrLiveViewProperty& r) { *this = r; }
+CrLiveViewProperty& CrLiveViewProperty::operator=(const CrLiveViewProperty& r) { std::memcpy((void*)this, &r, sizeof(*this)); return *this; }
+CrInt32u CrLiveViewProperty::GetCode() const { return code; }
+CrInt32u CrLiveViewProperty::GetTimeCode() const { return timeCode; }
+bool CrLiveViewProperty::IsGetEnableCurrentValue() const { return enableFlag != CrEnableValue_NotSupported; }
+CrFrameInfoType CrLiveViewProperty::GetFrameInfoType() const { return valueType; }
+CrInt32u CrLiveViewProperty::GetValueSize() const { return valueSize; }
+CrInt8u* CrLiveViewProperty::GetValue() const { return value; }
+
+bool Init(CrInt32u) { return true; }
+bool Release() { return true; }
+
+CrError CreateCameraObjectInfoEthernetConnection(ICrCameraObjectInfo** info, CrCameraDeviceModelList, CrInt32u, CrInt8u*, CrInt32u)
+{
+    *info = nullptr;
+    return CrError_Generic_NotSupported;
+}
+
+CrError GetFingerprint(ICrCameraObjectInfo*, char*, CrInt32u*) { return CrError_Generic_NotSupported; }
+
+CrError Connect(ICrCameraObjectInfo*, IDeviceCallback* callback, CrDeviceHandle* handle, CrSdkControlMode, CrReconnectingSet,
+    const char*, const char*, const char*, CrInt32u)
+{
+    m_sdkStub.callback = callback;
+    *handle = 1;
+    {
+        std::lock_guard<std::mutex> lock(m_stubMutex);
+        for(CrInt32u i = 0; i < STUB_PROPERTY_COUNT; i++) m_values.insert({ STUB_PROPERTY_FIRST + i, 0 });
+    }
+    _later(0, [] { m_sdkStub.callback->OnConnected(DeviceConnectionVersioin(0)); });
+    return 0;
+}
+
+CrError Disconnect(CrDeviceHandle)
+{
+    std::vector<std::thread> threads;
+    // events still on their way are delivered first
+    for(;;) {
+        {
+            std::lock_guard<std::mutex> lock(m_stubMutex);
+            threads.swap(m_threads);
+        }
+        if(threads.empty()) break;
+        for(std::thread& thread : threads) thread.join();
+        threads.clear();
+    }
+    if(m_sdkStub.callback) m_sdkStub.callback->OnDisconnected(0);
+    return 0;
+}
+
+CrError ReleaseDevice(CrDeviceHandle) { return 0; }
+
+static CrDeviceProperty _property(CrInt32u code, CrInt64u value)
+{
+    CrDeviceProperty prop;
+    prop.code = code;
+    prop.valueType = CrDataType_UInt16;
+    prop.currentValue = value;
+    return prop;
+}
+
+CrError GetDeviceProperties(CrDeviceHandle, CrDeviceProperty** props, CrInt32* num)
+{
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    *props = new CrDeviceProperty[m_values.size()];
+    *num = 0;
+    for(auto& value : m_values) (*props)[(*num)++] = _property(value.first, value.second);
+    return 0;
+}
+
+CrError GetSelectDeviceProperties(CrDeviceHandle, CrInt32u num, CrInt32u* codes, CrDeviceProperty** props, CrInt32* count)
+{
+    m_sdkStub.selects++;
+    std::lock_guard<std::mutex> lock(m_stubMutex);
+    *props = new CrDeviceProperty[num];
+    *count = 0;
+    for(CrInt32u i = 0; i < num; i++) {
+        auto value = m_values.find(codes[i]);
+        if(value != m_values.end()) (*props)[(*count)++] = _property(value->first, value->second);
+    }
+    return 0;
+}
+
+CrError ReleaseDeviceProperties(CrDeviceHandle, CrDeviceProperty* props)
+{
+    delete[] props;
+    return 0;
+}
+
+CrError SetDeviceProperty(CrDeviceHandle, CrDeviceProperty* prop)
+{
+    CrInt32u code = prop->code;
+    CrInt64u value = prop->currentValue;
+
+    m_sdkStub.sets++;
+    {
+        std::lock_guard<std::mutex> lock(m_stubMutex);
+        m_setCodes.push_back(code);
+        if(code == CrDeviceProperty_ZoomOperationWithInt16) m_zooms.push_back((CrInt16)value);
+    }
+    if(m_sdkStub.setError) return m_sdkStub.setError;
+    if(code == CrDeviceProperty_PresetPTZFSlotNumber) {
+        // a recall drives for longer the higher the slot
+        _later(m_sdkStub.ptzDelayMs * (int)value, [] {
+            m_sdkStub.callback->OnWarningExt(CrWarningExt_PresetPTZFEvent, CrWarningExtParam_PresetPTZFEvent_DriveCompleted, 0, 0);
+        });
+        return 0;
+    }
+    if(!m_sdkStub.setEvents) return 0;
+    _later(m_sdkStub.setDelayMs, [code, value] {
+        CrInt32u changed = code;
+        m_sdkStub.setValue(code, value);
+        m_sdkStub.callback->OnPropertyChangedCodes(1, &changed);
+    });
+    return 0;
+}
+
+CrError SendCommand(CrDeviceHandle, CrInt32u, CrCommandParam) { return 0; }
+
+CrError GetLiveViewImageInfo(CrDeviceHandle, CrImageInfo* info)
+{
+    info->bufferSize = 0x10000;
+    return 0;
+}
+
+CrError GetLiveViewImage(CrDeviceHandle, CrImageDataBlock* block)
+{
+    static const CrInt8u jpeg[] = { 0xFF, 0xD8, 0xFF, 0xD9 };
+    if(block->size < sizeof(jpeg)) return CrError_Memory_Insufficient;
+    std::memcpy(block->pData, jpeg, sizeof(jpeg));
+    block->imageSize = sizeof(jpeg);
+    return 0;
+}
+
+CrError GetLiveViewProperties(CrDeviceHandle, CrLiveViewProperty** props, CrInt32* num)
+{
+    *props = nullptr;
+    *num = 0;
+    return 0;
+}
+
+CrError ReleaseLiveViewProperties(CrDeviceHandle, CrLiveViewProperty* props)
+{
+    delete[] props;
+    return 0;
+}
+
+CrError GetDeviceSetting(CrDeviceHandle, CrInt32u, CrInt32u* value)
+{
+    *value = 0;
+    return 0;
+}
+
+CrError SetDeviceSetting(CrDeviceHandle, CrInt32u, CrInt32u) { return 0; }
+CrError SetSaveInfo(CrDeviceHandle, CrChar*, CrChar*, CrInt32) { return 0; }
+
+CrError ControlPTZF(CrDeviceHandle, CrPTZFControlType type, const CrPTZFSetting* setting)
+{
+    m_sdkStub.ptzCalls++;
+    if(type == CrPTZFControlType_Direction) {
+        std::lock_guard<std::mutex> lock(m_stubMutex);
+        m_directions.emplace_back(setting->pan.speed, setting->tilt.speed);
+        return 0;
+    }
+    if(type != CrPTZFControlType_Absolute && type != CrPTZFControlType_Relative && type != CrPTZFControlType_HomePosition) return 0;
+
+    CrInt32 pan = setting ? setting->pan.position : 0;
+    _later(m_sdkStub.ptzDelayMs, [type, pan] {
+        IDeviceCallback* callback = m_sdkStub.callback;
+        if(pan == STUB_PAN_NG) {
+            callback->OnWarningExt(CrWarningExt_ControlPTZFResult, CrError_Generic_InvalidParameter, CrWarningExtParam_ControlPTZFResult_NG, type);
+            return;
+        }
+        callback->OnWarningExt(CrWarningExt_ControlPTZFResult, 0, CrWarningExtParam_ControlPTZFResult_OK, type);
+        if(pan == STUB_PAN_SILENT) return;
+        callback->OnWarningExt(CrWarningExt_PresetPTZFEvent,
+            pan == STUB_PAN_INTERRUPTED ? CrWarningExtParam_PresetPTZFEvent_DriveInterrupted : CrWarningExtParam_PresetPTZFEvent_DriveCompleted, 0, 0);
+    });
+    return 0;
+}
+
+CrError PresetPTZFSet(CrDeviceHandle, CrInt16u, CrPresetPTZFSettingType, CrPresetPTZFThumbnail) { return 0; }
+CrError PresetPTZFClear(CrDeviceHandle, CrInt16u) { return 0; }
+
+}
@@ -0,0 +1,59 @@
+/* in-process stand-in for the Camera Remote SDK, for the tests */
+
+#ifndef CRSDKSTUB_H
+#define CRSDKSTUB_H
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "CRSDK/CameraRemote_SDK.h"
+#include "CRSDK/IDeviceCallback.h"
+
+#define STUB_PROPERTY_FIRST 0x100   // GetDeviceProperties returns STUB_PROPERTY_COUNT codes from here
+#define STUB_PROPERTY_COUNT 64
+
+// ControlPTZF absolute/relative pan positions that make the head misbehave
+#define STUB_PAN_NG 999             // ControlPTZFResult NG
+#define STUB_PAN_INTERRUPTED 998    // accepted, then DriveInterrupted
+#define STUB_PAN_SILENT 997         // accepted, the drive never reports
+
+// Behaviour of the stub, tests change it between calls. Events are
+// delivered from threads of their own, like the real SDK does.
+struct CrSdkStub
+{
+    SCRSDK::IDeviceCallback* callback = nullptr;
+
+    // SetDeviceProperty: the change event comes after setDelayMs, none at
+    // all without setEvents, and setError fails the call instead
+    std::atomic<int> setDelayMs{30};
+    std::atomic<bool> setEvents{true};
+    std::atomic<SCRSDK::CrError> setError{0};
+    // ControlPTZF absolute/relative/home drives and preset recalls, ms per slot
+    std::atomic<int> ptzDelayMs{50};
+
+    // calls
+    std::atomic<int> sets{0};
+    std::atomic<int> selects{0};
+    std::atomic<int> ptzCalls{0};
+
+    // back to the defaults, the property values are kept
+    void reset();
+    void setValue(CrInt32u code, CrInt64u value);
+    CrInt64u value(CrInt32u code);
+    // changed on the camera side, with its change event
+    void change(CrInt32u code, CrInt64u value);
+    // gone from the camera, no event
+    void remove(CrInt32u code);
+    // codes of the SetDeviceProperty calls since the last reset, in order
+    std::vector<CrInt32u> setCodes();
+    // pan/tilt speeds of the ControlPTZF direction calls and the
+    // ZoomOperationWithInt16 speeds set since the last reset, in order
+    std::vector<std::pair<CrInt32, CrInt32>> directions();
+    std::vector<CrInt16> zooms();
+};
+
+extern CrSdkStub m_sdkStub;
+
+#endif // CRSDKSTUB_H
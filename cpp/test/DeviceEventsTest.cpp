@@ -0,0 +1,176 @@
+// DeviceEventDispatcher under overload: what a full queue may drop is made
+// up for, connection events and WarningExt always get through in order.
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "DeviceEvents.h"
+#include "TestCheck.h"
+
+static DeviceEvent _event(CrInt32u type, CrInt32 param1 = 0, CrInt32 param2 = 0)
+{
+    DeviceEvent event;
+    event.type = type;
+    event.value = 0;
+    event.param1 = param1;
+    event.param2 = param2;
+    event.param3 = 0;
+    event.num = 0;
+    return event;
+}
+
+// index of the first event of type with param1, -1 when there is none
+static int _find(const std::vector<DeviceEvent>& events, CrInt32u type, CrInt32 param1 = 0)
+{
+    for(size_t i = 0; i < events.size(); i++) {
+        if(events[i].type == type && events[i].param1 == param1) return (int)i;
+    }
+    return -1;
+}
+
+// The handler hangs on its first batch while far more than a queue of
+// property changes comes in, with the events that must not be lost among them.
+static void blockedHandler()
+{
+    DeviceEventDispatcher dispatcher;
+    std::mutex mutex;
+    std::vector<DeviceEvent> seen;
+    std::promise<void> blocked;
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    bool first = true;
+
+    dispatcher.start([&](std::vector<DeviceEvent>& events) {
+        if(first) {
+            first = false;
+            blocked.set_value();
+            released.wait();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.insert(seen.end(), events.begin(), events.end());
+    });
+    CrInt32u code = 0x100;
+    dispatcher.pushCodes(DeviceEvent_PropertyChanged, 1, &code);
+    blocked.get_future().wait();
+
+    DeviceEvent event = _event(DeviceEvent_Connected);
+    dispatcher.push(event);
+    for(int i = 0; i < DEVICE_EVENT_QUEUE * 3; i++) {
+        code = 0x100 + (i & 0xff);
+        dispatcher.pushCodes(DeviceEvent_PropertyChanged, 1, &code);
+        if(i == DEVICE_EVENT_QUEUE * 2) dispatcher.pushCodes(DeviceEvent_LvPropertyChanged, 1, &code);
+    }
+    for(int i = 0; i < 5; i++) {
+        event = _event(DeviceEvent_WarningExt, i);
+        dispatcher.push(event);
+    }
+    dispatcher.push(DeviceEvent_Error, 1);
+    dispatcher.push(DeviceEvent_Disconnected, 2);
+
+    release.set_value();
+    dispatcher.stop();
+
+    DeviceEventStats stats = dispatcher.stats();
+    CHECK(stats.dropped > 0);
+    CHECK_EQ(stats.overflowed, 7);
+    CHECK_EQ(stats.resyncs, 1);
+    CHECK(_find(seen, DeviceEvent_Resync) >= 0);
+    // the codes are lost, the handler still learns that something changed
+    int lv = _find(seen, DeviceEvent_LvPropertyChanged);
+    CHECK(lv >= 0);
+    if(lv >= 0) CHECK_EQ(seen[lv].num, 0);
+
+    int connected = _find(seen, DeviceEvent_Connected);
+    int error = _find(seen, DeviceEvent_Error);
+    int disconnected = _find(seen, DeviceEvent_Disconnected);
+    int last = connected;
+    CHECK(connected >= 0);
+    for(int i = 0; i < 5; i++) {
+        int warning = _find(seen, DeviceEvent_WarningExt, i);
+        CHECK(warning > last);
+        last = warning;
+    }
+    CHECK(error > last);
+    CHECK(disconnected > error);
+}
+
+#define PRODUCERS 8
+#define PRODUCER_EVENTS 20000
+#define WARNING_EVERY 100
+
+// Producers on several threads against a slow handler. No WarningExt goes
+// missing or out of order, every property change either arrives or is
+// counted as dropped, and what arrives from one producer arrives in the
+// order it was pushed, kept aside or not. A change carries its index in
+// its code.
+static void stress()
+{
+    DeviceEventDispatcher dispatcher;
+    std::vector<std::vector<CrInt32>> warnings(PRODUCERS);
+    std::vector<std::thread> threads;
+    std::vector<int> last(PRODUCERS, -1);
+    std::vector<int> misordered(PRODUCERS, 0);
+    uint64_t changes = 0;
+    uint64_t batches = 0;
+
+    dispatcher.start([&](std::vector<DeviceEvent>& events) {
+        for(DeviceEvent& event : events) {
+            int p, i;
+            if(event.type == DeviceEvent_WarningExt) {
+                p = event.param1;
+                i = event.param2 * WARNING_EVERY;
+                warnings[p].push_back(event.param2);
+            } else if(event.type == DeviceEvent_PropertyChanged) {
+                p = event.codes[0] / PRODUCER_EVENTS;
+                i = event.codes[0] % PRODUCER_EVENTS;
+                changes++;
+            } else {
+                continue;
+            }
+            if(i <= last[p]) misordered[p]++;
+            last[p] = i;
+        }
+        if(++batches % 4 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    for(int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([&dispatcher, p] {
+            for(int i = 0; i < PRODUCER_EVENTS; i++) {
+                if(i % WARNING_EVERY == 0) {
+                    DeviceEvent event = _event(DeviceEvent_WarningExt, p, i / WARNING_EVERY);
+                    dispatcher.push(event);
+                } else {
+                    CrInt32u code = p * PRODUCER_EVENTS + i;
+                    dispatcher.pushCodes(DeviceEvent_PropertyChanged, 1, &code);
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads) thread.join();
+    dispatcher.stop();
+
+    DeviceEventStats stats = dispatcher.stats();
+    printf("%d events, %llu dropped, %llu overflowed, %llu resyncs\n", PRODUCERS * PRODUCER_EVENTS,
+        (unsigned long long)stats.dropped, (unsigned long long)stats.overflowed, (unsigned long long)stats.resyncs);
+    CHECK_EQ(changes + stats.dropped, PRODUCERS * (PRODUCER_EVENTS - PRODUCER_EVENTS / WARNING_EVERY));
+    for(int p = 0; p < PRODUCERS; p++) {
+        CHECK_EQ(misordered[p], 0);
+        CHECK_EQ(warnings[p].size(), PRODUCER_EVENTS / WARNING_EVERY);
+        for(size_t i = 0; i < warnings[p].size(); i++) {
+            if(warnings[p][i] != (CrInt32)i) {
+                CHECK_EQ(warnings[p][i], i);
+                break;
+            }
+        }
+    }
+}
+
+int main()
+{
+    blockedHandler();
+    stress();
+    return m_testFailures ? 1 : 0;
+}
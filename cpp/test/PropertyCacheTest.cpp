@@ -0,0 +1,62 @@
+// PropertyCache load and refresh against the stub: codes the camera no
+// longer returns stop being served.
+
+#include <algorithm>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "PropertyCache.h"
+#include "RemoteCli.h"
+#include "TestCheck.h"
+
+static bool _cached(CrInt32u code)
+{
+    std::vector<CrInt32u> codes;
+    m_propCache.codes(&codes);
+    return std::find(codes.begin(), codes.end(), code) != codes.end();
+}
+
+static void load()
+{
+    PropertyCacheStats before = m_propCache.stats();
+    PropertyEntry entry;
+    const CrInt32u code = STUB_PROPERTY_FIRST + 1;
+
+    CHECK(m_propCache.get(code, &entry));
+    m_sdkStub.remove(code);
+    CHECK_EQ(m_propCache.load(m_device_handle), 0);
+    CHECK(!m_propCache.get(code, &entry));
+    CHECK(!_cached(code));
+    CHECK_EQ(m_propCache.stats().entries, before.entries - 1);
+
+    // back on the camera, back in the cache
+    m_sdkStub.setValue(code, 7);
+    CHECK_EQ(m_propCache.load(m_device_handle), 0);
+    CHECK(m_propCache.get(code, &entry));
+    CHECK_EQ(entry.current, 7);
+    CHECK_EQ(m_propCache.stats().entries, before.entries);
+}
+
+static void refresh()
+{
+    PropertyEntry entry;
+    const CrInt32u codes[] = { STUB_PROPERTY_FIRST + 2, STUB_PROPERTY_FIRST + 3 };
+
+    m_sdkStub.setValue(codes[0], 5);
+    m_sdkStub.remove(codes[1]);
+    CHECK_EQ(m_propCache.refresh(m_device_handle, 2, codes), 0);
+    CHECK(m_propCache.get(codes[0], &entry));
+    CHECK_EQ(entry.current, 5);
+    // asked for and not returned: not served with its old value
+    CHECK(!m_propCache.get(codes[1], &entry));
+    CHECK(!_cached(codes[1]));
+}
+
+int main()
+{
+    testConnect();
+    load();
+    refresh();
+    testDisconnect();
+    return m_testFailures ? 1 : 0;
+}
@@ -0,0 +1,148 @@
+// Blocking sets of different codes from many threads at once: each waits for
+// its own change event, so they all complete in about one set's time.
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "DeviceProperty.h"
+#include "RemoteCli.h"
+#include "TestCheck.h"
+
+#define SETS 50
+#define SET_MS 100      // change event delay of the stub
+
+static void concurrentSets()
+{
+    std::vector<std::thread> threads;
+    std::vector<SCRSDK::CrError> errs(SETS, SCRSDK::CrError_Generic_Unknown);
+
+    m_sdkStub.setDelayMs = SET_MS;
+    double begin = testNowMs();
+    for(int i = 0; i < SETS; i++) {
+        threads.emplace_back([i, &errs] { errs[i] = _setDeviceProperty(m_device_handle, STUB_PROPERTY_FIRST + i, 1000 + i); });
+    }
+    for(std::thread& thread : threads) thread.join();
+    double elapsed = testNowMs() - begin;
+
+    for(int i = 0; i < SETS; i++) {
+        CHECK_EQ(errs[i], 0);
+        CHECK_EQ(m_sdkStub.value(STUB_PROPERTY_FIRST + i), 1000 + i);
+    }
+    CHECK_EQ(m_sdkStub.sets, SETS);
+    // one after the other they would take SETS * SET_MS
+    printf("%d sets in %.1fms\n", SETS, elapsed);
+    CHECK(elapsed < SET_MS * 5);
+
+    std::vector<PropertySetStats> stats;
+    getPropertySetStats(&stats);
+    CHECK_EQ(stats.size(), SETS);
+    for(PropertySetStats& st : stats) {
+        CHECK_EQ(st.acks, 1);
+        CHECK_EQ(st.timeouts, 0);
+    }
+}
+
+// sets of the same code from several threads all see the last change event
+static void sameCode()
+{
+    std::vector<std::thread> threads;
+    std::atomic<int> failed(0);
+
+    m_sdkStub.setDelayMs = 20;
+    for(int i = 0; i < 8; i++) {
+        threads.emplace_back([i, &failed] { if(_setDeviceProperty(m_device_handle, STUB_PROPERTY_FIRST, 2000 + i)) failed++; });
+    }
+    for(std::thread& thread : threads) thread.join();
+    CHECK_EQ(failed, 0);
+}
+
+// A set that was sent but not yet acknowledged keeps a set of the cached
+// value from being skipped. One that failed or was never answered must not.
+static void pendingSets()
+{
+    const CrInt32u failed = STUB_PROPERTY_FIRST + 60, unanswered = STUB_PROPERTY_FIRST + 61, open = STUB_PROPERTY_FIRST + 62;
+    int sets;
+
+    // rejected by the camera, the cached 0 is still current
+    m_sdkStub.setError = SCRSDK::CrError_Generic_Unknown;
+    CHECK(_setDeviceProperty(m_device_handle, failed, 5, false) != 0);
+    m_sdkStub.setError = 0;
+    sets = m_sdkStub.sets;
+    CHECK_EQ(_setDeviceProperty(m_device_handle, failed, 0), 0);
+    CHECK_EQ(m_sdkStub.sets, sets);
+
+    // no change event comes, the value may still change
+    m_sdkStub.setEvents = false;
+    CHECK_EQ(_setDeviceProperty(m_device_handle, open, 5, false), 0);
+    sets = m_sdkStub.sets;
+    CHECK(_setDeviceProperty(m_device_handle, open, 0, true, 50) != 0);
+    CHECK_EQ(m_sdkStub.sets, sets + 1);
+
+    // one set of the code failing leaves the other one open
+    m_sdkStub.setError = SCRSDK::CrError_Generic_Unknown;
+    CHECK(_setDeviceProperty(m_device_handle, open, 7, false) != 0);
+    m_sdkStub.setError = 0;
+    sets = m_sdkStub.sets;
+    CHECK(_setDeviceProperty(m_device_handle, open, 0, true, 50) != 0);
+    CHECK_EQ(m_sdkStub.sets, sets + 1);
+
+    // until its timeout and the grace are over
+    CHECK_EQ(_setDeviceProperty(m_device_handle, unanswered, 5, false, 100), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100 + PROPERTY_SET_GRACE + 50));
+    sets = m_sdkStub.sets;
+    CHECK_EQ(_setDeviceProperty(m_device_handle, unanswered, 0), 0);
+    CHECK_EQ(m_sdkStub.sets, sets);
+    m_sdkStub.setEvents = true;
+}
+
+static PropertySetStats _stats(CrInt32u code)
+{
+    std::vector<PropertySetStats> stats;
+    getPropertySetStats(&stats);
+    for(PropertySetStats& st : stats) {
+        if(st.code == code) return st;
+    }
+    return PropertySetStats();
+}
+
+// A change event after the set timed out is counted as late, not as an
+// acknowledge, and after the grace period not at all.
+static void lateEvents()
+{
+    const CrInt32u late = STUB_PROPERTY_FIRST + 63, expired = STUB_PROPERTY_FIRST + 59;
+    PropertySetStats st;
+
+    m_sdkStub.setDelayMs = 150;
+    CHECK(_setDeviceProperty(m_device_handle, late, 1, true, 50) != 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    st = _stats(late);
+    CHECK_EQ(st.timeouts, 1);
+    CHECK_EQ(st.late, 1);
+    CHECK_EQ(st.acks, 0);
+
+    m_sdkStub.setDelayMs = 50 + PROPERTY_SET_GRACE + 200;
+    CHECK(_setDeviceProperty(m_device_handle, expired, 1, true, 50) != 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(PROPERTY_SET_GRACE + 300));
+    CHECK_EQ(m_sdkStub.value(expired), 1);
+    st = _stats(expired);
+    CHECK_EQ(st.timeouts, 1);
+    CHECK_EQ(st.late, 0);
+    CHECK_EQ(st.acks, 0);
+}
+
+int main()
+{
+    testConnect();
+    concurrentSets();
+    m_sdkStub.reset();
+    sameCode();
+    m_sdkStub.reset();
+    pendingSets();
+    m_sdkStub.reset();
+    lateEvents();
+    testDisconnect();
+    return m_testFailures ? 1 : 0;
+}
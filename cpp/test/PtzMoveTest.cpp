@@ -0,0 +1,103 @@
+// PtzControl move futures resolved by the stub's ControlPTZFResult and
+// PresetPTZFEvent warnings, or by their timeout or a disconnect.
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "PtzControl.h"
+#include "RemoteCli.h"
+#include "TestCheck.h"
+
+#define DRIVE_MS 50
+
+static PtzMoveResult _move(CrInt32 pan, int timeout_ms = PTZ_MOVE_TIMEOUT)
+{
+    SCRSDK::CrPTZFSetting setting;
+    setting.pan.exists = 1;
+    setting.pan.position = pan;
+    setting.pan.speed = 1;
+    setting.tilt.exists = 0;
+    return m_ptz.moveAsync(SCRSDK::CrPTZFControlType_Absolute, &setting, timeout_ms).get();
+}
+
+static void results()
+{
+    PtzMoveResult res;
+
+    m_sdkStub.ptzDelayMs = DRIVE_MS;
+    res = _move(100);
+    CHECK_EQ(res.status, PtzMove_Completed);
+    CHECK_EQ(res.err, 0);
+    CHECK(res.ns >= DRIVE_MS * 1000000LL);
+
+    res = _move(STUB_PAN_NG);
+    CHECK_EQ(res.status, PtzMove_NG);
+    CHECK_EQ(res.err, SCRSDK::CrError_Generic_InvalidParameter);
+
+    res = _move(STUB_PAN_INTERRUPTED);
+    CHECK_EQ(res.status, PtzMove_Interrupted);
+
+    // accepted, then nothing
+    double begin = testNowMs();
+    res = _move(STUB_PAN_SILENT, 300);
+    CHECK_EQ(res.status, PtzMove_Timeout);
+    CHECK(testNowMs() - begin >= 300);
+    CHECK(testNowMs() - begin < 1000);
+
+    // a recall drives for DRIVE_MS per slot in the stub
+    begin = testNowMs();
+    res = m_ptz.recallAsync(3).get();
+    CHECK_EQ(res.status, PtzMove_Completed);
+    CHECK(testNowMs() - begin >= 3 * DRIVE_MS);
+}
+
+// a stop the camera refused goes out again until it gets through
+static void retry()
+{
+    m_sdkStub.reset();
+    m_ptz.zoom(100);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    m_sdkStub.setError = SCRSDK::CrError_Generic_Unknown;
+    m_ptz.zoom(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    m_sdkStub.setError = 0;
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    std::vector<CrInt16> zooms = m_sdkStub.zooms();
+    CHECK(zooms.size() >= 3);
+    CHECK_EQ(zooms.front(), 100);
+    CHECK_EQ(zooms.back(), 0);
+    // nothing more once it did
+    size_t sent = zooms.size();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK_EQ(m_sdkStub.zooms().size(), sent);
+}
+
+// a move still out when the camera goes away fails at once
+static void disconnect()
+{
+    SCRSDK::CrPTZFSetting setting;
+    setting.pan.exists = 1;
+    setting.pan.position = STUB_PAN_SILENT;
+    setting.pan.speed = 1;
+    setting.tilt.exists = 0;
+    std::future<PtzMoveResult> future = m_ptz.moveAsync(SCRSDK::CrPTZFControlType_Absolute, &setting);
+
+    testDisconnect();
+    CHECK(future.wait_for(std::chrono::milliseconds(100)) == std::future_status::ready);
+    PtzMoveResult res = future.get();
+    CHECK_EQ(res.status, PtzMove_Failed);
+    CHECK_EQ(res.err, SCRSDK::CrError_Connect_Disconnected);
+}
+
+int main()
+{
+    testConnect();
+    results();
+    retry();
+    disconnect();
+    return m_testFailures ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+// Preset tours against the stub: steps start on time after the previous
+// drive completed plus its dwell, and the tour file is checked.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "PtzTour.h"
+#include "RemoteCli.h"
+#include "TestCheck.h"
+
+#define TOUR_FILE "PtzTourTest.tour"
+#define DRIVE_MS 40
+#define LATE_MAX_MS 20      // start lateness allowed on a busy machine, a quiet one is in the us
+
+static void _write(const char* text)
+{
+    std::ofstream file(TOUR_FILE);
+    file << text;
+}
+
+static void parse()
+{
+    std::vector<PtzTourStep> steps;
+
+    _write("# comment\npreset 2 dwell=100\n\nabs -100 200 speed=5,6 timeout=900 next=0\n");
+    CHECK_EQ(ptzTourRead(TOUR_FILE, &steps), 0);
+    CHECK_EQ(steps.size(), 2);
+    if(steps.size() == 2) {
+        CHECK(steps[0].preset);
+        CHECK_EQ(steps[0].slot, 2);
+        CHECK_EQ(steps[0].dwell, 100);
+        CHECK_EQ(steps[0].next, 1);
+        CHECK(!steps[1].preset);
+        CHECK_EQ(steps[1].pan, -100);
+        CHECK_EQ(steps[1].tilt, 200);
+        CHECK_EQ(steps[1].panSpeed, 5);
+        CHECK_EQ(steps[1].tiltSpeed, 6);
+        CHECK_EQ(steps[1].timeout, 900);
+        CHECK_EQ(steps[1].next, 0);
+    }
+
+    _write("preset 0\n");
+    CHECK(ptzTourRead(TOUR_FILE, &steps) != 0);
+    _write("abs 1 2 dwell=x\n");
+    CHECK(ptzTourRead(TOUR_FILE, &steps) != 0);
+    _write("preset 1 next=5\n");
+    CHECK(ptzTourRead(TOUR_FILE, &steps) != 0);
+    _write("# nothing\n");
+    CHECK(ptzTourRead(TOUR_FILE, &steps) != 0);
+}
+
+static void timing()
+{
+    PtzTour tour;
+    std::vector<PtzTourStep> steps;
+    std::vector<PtzTourRecord> records;
+    const int dwell[] = { 100, 50, 0 };
+
+    m_sdkStub.ptzDelayMs = DRIVE_MS;
+    _write("preset 1 dwell=100\nabs 100 200 dwell=50\npreset 2\n");
+    CHECK_EQ(ptzTourRead(TOUR_FILE, &steps), 0);
+    CHECK_EQ(tour.start(steps), 0);
+    for(int i = 0; i < 100 && tour.running(); i++) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    CHECK(!tour.running());
+
+    tour.records(&records);
+    CHECK_EQ(records.size(), 3);
+    if(records.size() != 3) return;
+    for(size_t i = 0; i < records.size(); i++) {
+        CHECK_EQ(records[i].step, i);
+        CHECK_EQ(records[i].status, PtzMove_Completed);
+        CHECK(records[i].late >= 0);
+        CHECK(records[i].late < LATE_MAX_MS * 1000000LL);
+        printf("step %d due %.3fms late %.3fms move %.1fms\n", records[i].step, records[i].planned / 1e6,
+            records[i].late / 1e6, records[i].move / 1e6);
+    }
+    // recall of slot 1 and 2 in the stub drive 1 and 2 times DRIVE_MS
+    CHECK(records[0].move >= DRIVE_MS * 1000000LL);
+    CHECK(records[2].move >= 2 * DRIVE_MS * 1000000LL);
+    // each step is due when the one before arrived plus its dwell
+    for(size_t i = 1; i < records.size(); i++) {
+        const PtzTourRecord& prev = records[i - 1];
+        int64_t arrived = prev.planned + prev.late + prev.move;
+        CHECK(records[i].planned - arrived >= dwell[i - 1] * 1000000LL);
+        CHECK(records[i].planned - arrived < (dwell[i - 1] + 1) * 1000000LL);
+    }
+    CHECK_EQ(tour.late.count(), 3);
+}
+
+// a looping tour runs until stopped
+static void loop()
+{
+    PtzTour tour;
+    std::vector<PtzTourStep> steps;
+    std::vector<PtzTourRecord> records;
+
+    m_sdkStub.ptzDelayMs = 10;
+    _write("preset 1 dwell=10 next=0\n");
+    CHECK_EQ(ptzTourRead(TOUR_FILE, &steps), 0);
+    CHECK_EQ(tour.start(steps), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    CHECK(tour.running());
+    tour.stop();
+    CHECK(!tour.running());
+    tour.records(&records);
+    CHECK(records.size() >= 3);
+}
+
+// a stop during a drive returns at once and cancels it
+static void stopDriving()
+{
+    PtzTour tour;
+    std::vector<PtzTourStep> steps;
+
+    m_sdkStub.reset();
+    m_sdkStub.ptzDelayMs = 500;
+    _write("preset 1\n");
+    CHECK_EQ(ptzTourRead(TOUR_FILE, &steps), 0);
+    CHECK_EQ(tour.start(steps), 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(tour.running());
+    double begin = testNowMs();
+    tour.stop();
+    CHECK(testNowMs() - begin < 20);
+    CHECK(!tour.running());
+    CHECK_EQ(m_sdkStub.ptzCalls, 1);
+
+    // stopped when not driving, nothing is sent
+    tour.stop();
+    CHECK_EQ(m_sdkStub.ptzCalls, 1);
+    // the drive left behind resolves with no tour to wake
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+}
+
+int main()
+{
+    parse();
+    testConnect();
+    timing();
+    loop();
+    stopDriving();
+    testDisconnect();
+    remove(TOUR_FILE);
+    return m_testFailures ? 1 : 0;
+}
@@ -0,0 +1,248 @@
+// S-curve planning, the streamed commands and the head model, no camera
+// needed: the limits hold, the axes arrive together and the summed commands
+// land on the target. Then a trajectory streamed to the stub, every
+// command of it.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "PtzControl.h"
+#include "PtzTrajectory.h"
+#include "RemoteCli.h"
+#include "TestCheck.h"
+
+#define RATE 20
+#define SAMPLE 0.0001       // s between samples of a plan
+#define SLACK 1.000001      // float rounding on a limit
+
+static const PtzTrajConfig m_conf = {
+    { 1000, 1000, 1 },
+    { 50, 50, 32767 },
+    { 50000, 50000, 20000 },
+    { 200000, 200000, 80000 },
+    0,
+};
+
+struct Peaks
+{
+    double speed;
+    double accel;
+    double jerk;
+};
+
+// Samples one curve and checks it runs forward from 0 to distance and stops
+// there. The jerk is the change of acceleration over a sample, which stays
+// within the limit as the acceleration is continuous.
+static Peaks _curve(const SCurve& curve, double distance)
+{
+    Peaks peaks = { 0, 0, 0 };
+    double last = 0, lastAcc = 0;
+
+    for(double t = SAMPLE; t < curve.duration(); t += SAMPLE) {
+        double pos, vel, acc;
+        curve.sample(t, &pos, &vel, &acc);
+        CHECK(pos >= last - 1e-9);
+        CHECK(vel >= -1e-9);
+        peaks.speed = std::max(peaks.speed, vel);
+        peaks.accel = std::max(peaks.accel, std::fabs(acc));
+        peaks.jerk = std::max(peaks.jerk, std::fabs(acc - lastAcc) / SAMPLE);
+        last = pos;
+        lastAcc = acc;
+    }
+    // the segments add up to the distance, sampled from inside the last one
+    double pos, vel;
+    curve.sample(curve.duration() * (1 - 1e-9), &pos, &vel);
+    CHECK(std::fabs(pos - distance) < distance * 1e-6);
+    CHECK(std::fabs(vel) < 1e-3);
+    curve.sample(curve.duration(), &pos, &vel);
+    CHECK_EQ(pos, distance);
+    return peaks;
+}
+
+// distance 100, speed 10, accel 20 and jerk 100: accel is reached after
+// 0.2 s, speed after 0.7 s, speeding up and slowing down cover 7
+static void scurve()
+{
+    SCurve curve;
+    Peaks peaks;
+
+    // every phase
+    curve.plan(100, 10, 20, 100);
+    peaks = _curve(curve, 100);
+    CHECK(std::fabs(peaks.speed - 10) < 1e-6);
+    CHECK(peaks.accel <= 20 * SLACK);
+    CHECK(peaks.accel > 20 * 0.999);
+    CHECK(peaks.jerk <= 100 * SLACK);
+    CHECK(std::fabs(curve.duration() - (100.0 / 10 + 0.7)) < 1e-9);
+
+    // speed is reached before accel, no constant acceleration
+    curve.plan(100, 1, 20, 100);
+    peaks = _curve(curve, 100);
+    CHECK(std::fabs(peaks.speed - 1) < 1e-6);
+    CHECK(peaks.accel < 20 * 0.9);
+    CHECK(peaks.jerk <= 100 * SLACK);
+
+    // too short to cruise, accel is still reached
+    curve.plan(4, 10, 20, 100);
+    peaks = _curve(curve, 4);
+    CHECK(peaks.speed < 10 * 0.9);
+    CHECK(peaks.accel <= 20 * SLACK);
+    CHECK(peaks.accel > 20 * 0.999);
+    CHECK(peaks.jerk <= 100 * SLACK);
+
+    // too short for either, jerk up and down only
+    curve.plan(0.5, 10, 20, 100);
+    peaks = _curve(curve, 0.5);
+    CHECK(peaks.speed < 10 * 0.9);
+    CHECK(peaks.accel < 20 * 0.9);
+    CHECK(peaks.jerk <= 100 * SLACK);
+    CHECK(std::fabs(curve.duration() - 4 * std::cbrt(0.5 / 200)) < 1e-9);
+
+    // nothing to do
+    curve.plan(0, 10, 20, 100);
+    CHECK_EQ(curve.duration(), 0);
+}
+
+// Every axis stays inside its own limits and all of them are the same
+// fraction of the way at any time.
+static void trajectory(const double from[PTZ_AXES], const double to[PTZ_AXES])
+{
+    PtzTrajectory traj;
+    Peaks peaks[PTZ_AXES] = {};
+    double lastVel[PTZ_AXES] = { 0, 0, 0 }, lastAcc[PTZ_AXES] = { 0, 0, 0 };
+
+    traj.plan(from, to, m_conf);
+    CHECK(traj.duration() > 0);
+    for(double t = SAMPLE; t < traj.duration(); t += SAMPLE) {
+        double pos[PTZ_AXES], vel[PTZ_AXES];
+        double share = -1;
+        traj.sample(t, pos, vel);
+        for(int i = 0; i < PTZ_AXES; i++) {
+            double acc = (vel[i] - lastVel[i]) / SAMPLE;
+            if(t > SAMPLE) peaks[i].jerk = std::max(peaks[i].jerk, std::fabs(acc - lastAcc[i]) / SAMPLE);
+            peaks[i].speed = std::max(peaks[i].speed, std::fabs(vel[i]));
+            peaks[i].accel = std::max(peaks[i].accel, std::fabs(acc));
+            lastVel[i] = vel[i];
+            lastAcc[i] = acc;
+            if(to[i] == from[i]) {
+                CHECK_EQ(pos[i], from[i]);
+                continue;
+            }
+            double s = (pos[i] - from[i]) / (to[i] - from[i]);
+            if(share < 0) share = s;
+            CHECK(std::fabs(s - share) < 1e-9);
+        }
+    }
+    for(int i = 0; i < PTZ_AXES; i++) {
+        // the acceleration and jerk are differences, a little over on a busy curve
+        CHECK(peaks[i].speed <= m_conf.step[i] * m_conf.maxSpeed[i] * SLACK);
+        CHECK(peaks[i].accel <= m_conf.accel[i] * 1.001);
+        CHECK(peaks[i].jerk <= m_conf.jerk[i] * 1.01);
+    }
+}
+
+// The commands stay inside maxSpeed and take every axis along the plan
+// within half a step of rounding at each tick, so they move together, and
+// a head acting on them stops within one step of the target, however late
+// it acts. One step is how far a speed step goes in a command period.
+static void commands(const double from[PTZ_AXES], const double to[PTZ_AXES])
+{
+    PtzTrajectory traj;
+    std::vector<PtzTrajCommand> cmds;
+    PtzSimResult res;
+    double sent[PTZ_AXES], plan[PTZ_AXES];
+
+    traj.plan(from, to, m_conf);
+    ptzTrajCommands(traj, m_conf, RATE, &cmds);
+    CHECK_EQ(cmds.size(), (int)std::ceil(traj.duration() * RATE) + 1);
+    CHECK(cmds.back().pan == 0 && cmds.back().tilt == 0 && cmds.back().zoom == 0);
+
+    std::copy(from, from + PTZ_AXES, sent);
+    for(size_t k = 0; k < cmds.size(); k++) {
+        const int speed[PTZ_AXES] = { cmds[k].pan, cmds[k].tilt, cmds[k].zoom };
+        traj.sample((k + 1.0) / RATE, plan);
+        for(int i = 0; i < PTZ_AXES; i++) {
+            CHECK(std::abs(speed[i]) <= m_conf.maxSpeed[i]);
+            sent[i] += speed[i] * m_conf.step[i] / RATE;
+            CHECK(std::fabs(sent[i] - plan[i]) <= m_conf.step[i] / RATE / 2 * SLACK);
+        }
+    }
+
+    const double latencies[] = { 0, 0.12 };
+    for(double latency : latencies) {
+        const PtzHeadModel head = { latency, { 0, 0, 0 } };
+        ptzTrajSimulate(traj, cmds, m_conf, RATE, head, &res);
+        printf("%.0f %.0f %.0f in %.3fs, latency %.0fms: error %.2f %.2f %.2f, peak speed %.0f %.0f %.0f/s\n",
+            to[0] - from[0], to[1] - from[1], to[2] - from[2], traj.duration(), latency * 1000,
+            res.finalError[0], res.finalError[1], res.finalError[2], res.peakSpeed[0], res.peakSpeed[1], res.peakSpeed[2]);
+        for(int i = 0; i < PTZ_AXES; i++) {
+            CHECK(std::fabs(res.finalError[i]) <= m_conf.step[i] / RATE);
+            CHECK(res.peakSpeed[i] <= m_conf.step[i] * m_conf.maxSpeed[i] * SLACK);
+        }
+        CHECK(res.duration >= traj.duration() + latency);
+        CHECK(res.duration < traj.duration() + latency + 2.0 / RATE);
+    }
+}
+
+// The stub gets every speed change of the plan in order, then the stop,
+// none coalesced away by the sender.
+static void stream(const double to[PTZ_AXES])
+{
+    const double from[PTZ_AXES] = { 0, 0, 0 };
+    PtzTrajectory traj;
+    std::vector<PtzTrajCommand> cmds;
+    std::vector<std::pair<CrInt32, CrInt32>> directions;
+    std::vector<CrInt16> zooms;
+
+    m_ptz.setRate(50);
+    traj.plan(from, to, m_trajConfig);
+    ptzTrajCommands(traj, m_trajConfig, m_ptz.rate(), &cmds);
+    for(const PtzTrajCommand& cmd : cmds) {
+        std::pair<CrInt32, CrInt32> direction(cmd.pan, cmd.tilt);
+        if(direction != (directions.empty() ? std::make_pair(0, 0) : directions.back())) directions.push_back(direction);
+        if(cmd.zoom != (zooms.empty() ? 0 : zooms.back())) zooms.push_back(cmd.zoom);
+    }
+    directions.emplace_back(0, 0);     // halt
+    CHECK(directions.size() + zooms.size() > 10);
+
+    m_sdkStub.reset();
+    CHECK_EQ(_ptzTrajectory(m_device_handle, to, true), 0);
+    CHECK(m_sdkStub.directions() == directions);
+    CHECK(m_sdkStub.zooms() == zooms);
+    CHECK_EQ(m_ptz.stats().coalesced, 0);
+}
+
+int main()
+{
+    const double origin[PTZ_AXES] = { 0, 0, 0 };
+    // cruises at maxSpeed on pan
+    const double longMove[PTZ_AXES] = { 200000, -30000, 10000 };
+    // pan and tilt only, short of cruise
+    const double shortMove[PTZ_AXES] = { -3000, 1500, 0 };
+    // zoom only, short of both cruise and constant acceleration
+    const double zoomMove[PTZ_AXES] = { 0, 0, 300 };
+    const double from[PTZ_AXES] = { -50000, 20000, 4000 };
+
+    scurve();
+    trajectory(origin, longMove);
+    trajectory(origin, shortMove);
+    trajectory(origin, zoomMove);
+    trajectory(from, longMove);
+    commands(origin, longMove);
+    commands(origin, shortMove);
+    commands(origin, zoomMove);
+    commands(from, longMove);
+
+    m_sdkStub.setValue(SCRSDK::CrDeviceProperty_PanPositionCurrentValue, 0);
+    m_sdkStub.setValue(SCRSDK::CrDeviceProperty_TiltPositionCurrentValue, 0);
+    m_sdkStub.setValue(SCRSDK::CrDeviceProperty_ZoomPositionCurrentValue, 0);
+    m_sdkStub.setEvents = false;
+    testConnect();
+    stream(shortMove);
+    stream(zoomMove);
+    testDisconnect();
+    return m_testFailures ? 1 : 0;
+}
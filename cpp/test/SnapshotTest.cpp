@@ -0,0 +1,105 @@
+// Snapshot save, diff and apply against the stub: what changed is set back,
+// modes before the values they govern, operations never.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "CrSdkStub.h"
+#include "PropertyCache.h"
+#include "RemoteCli.h"
+#include "Snapshot.h"
+#include "TestCheck.h"
+
+#define SNAPSHOT_FILE "SnapshotTest.crps"
+
+static const CrInt32u m_ctrl = SCRSDK::CrDeviceProperty_ExposureCtrlType;       // stage 0
+static const CrInt32u m_program = SCRSDK::CrDeviceProperty_ExposureProgramMode; // stage 1
+static const CrInt32u m_fnumber = SCRSDK::CrDeviceProperty_FNumber;             // last stage
+static const CrInt32u m_zoom = SCRSDK::CrDeviceProperty_ZoomOperationWithInt16; // an operation
+
+static int _index(const std::vector<CrInt32u>& codes, CrInt32u code)
+{
+    auto it = std::find(codes.begin(), codes.end(), code);
+    return it == codes.end() ? -1 : (int)(it - codes.begin());
+}
+
+static void saveAndRead()
+{
+    std::vector<SnapshotEntry> entries;
+
+    CHECK_EQ(_snapshotSave(m_device_handle, SNAPSHOT_FILE), 0);
+    CHECK_EQ(snapshotRead(SNAPSHOT_FILE, &entries), 0);
+    CHECK_EQ(entries.size(), STUB_PROPERTY_COUNT + 2);  // ExposureCtrlType and the zoom are outside the range
+    for(SnapshotEntry& entry : entries) {
+        CHECK_EQ(entry.value, m_sdkStub.value(entry.code));
+        CHECK(entry.setEnable);
+    }
+
+    // a file cut short is refused rather than half read
+    std::vector<char> buf;
+    {
+        std::ifstream in(SNAPSHOT_FILE, std::ios::binary);
+        buf.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(SNAPSHOT_FILE ".cut", std::ios::binary);
+        out.write(buf.data(), buf.size() - 1);
+    }
+    CHECK(snapshotRead(SNAPSHOT_FILE ".cut", &entries) != 0);
+    remove(SNAPSHOT_FILE ".cut");
+}
+
+static void apply()
+{
+    // changed on the camera after the save
+    m_sdkStub.change(m_ctrl, 2);
+    m_sdkStub.change(m_program, 0x8051);
+    m_sdkStub.change(m_fnumber, 560);
+    m_sdkStub.change(m_zoom, 5);
+    m_sdkStub.reset();
+    m_sdkStub.setDelayMs = 10;
+
+    CHECK_EQ(_snapshotDiff(m_device_handle, SNAPSHOT_FILE), 0);
+    CHECK_EQ(_snapshotApply(m_device_handle, SNAPSHOT_FILE), 0);
+    CHECK_EQ(m_sdkStub.value(m_ctrl), 1);
+    CHECK_EQ(m_sdkStub.value(m_program), 0x8050);
+    CHECK_EQ(m_sdkStub.value(m_fnumber), 280);
+    // an operation would move the lens, it is left alone
+    CHECK_EQ(m_sdkStub.value(m_zoom), 5);
+
+    std::vector<CrInt32u> codes = m_sdkStub.setCodes();
+    CHECK_EQ(codes.size(), 3);
+    CHECK(_index(codes, m_ctrl) >= 0);
+    CHECK(_index(codes, m_ctrl) < _index(codes, m_program));
+    CHECK(_index(codes, m_program) < _index(codes, m_fnumber));
+
+    // nothing differs any more, nothing is sent
+    m_sdkStub.reset();
+    CHECK_EQ(_snapshotApply(m_device_handle, SNAPSHOT_FILE), 0);
+    CHECK_EQ(m_sdkStub.sets, 0);
+
+    // changed with no event yet, the cache still has the saved value
+    m_sdkStub.setValue(m_fnumber, 400);
+    m_sdkStub.reset();
+    CHECK_EQ(_snapshotApply(m_device_handle, SNAPSHOT_FILE), 0);
+    CHECK_EQ(m_sdkStub.value(m_fnumber), 280);
+    CHECK_EQ(m_sdkStub.sets, 1);
+}
+
+int main()
+{
+    m_sdkStub.setValue(m_ctrl, 1);
+    m_sdkStub.setValue(m_program, 0x8050);
+    m_sdkStub.setValue(m_fnumber, 280);
+    m_sdkStub.setValue(m_zoom, 0);
+    testConnect();
+
+    saveAndRead();
+    apply();
+
+    testDisconnect();
+    remove(SNAPSHOT_FILE);
+    return m_testFailures ? 1 : 0;
+}
@@ -0,0 +1,26 @@
+/* minimal checks for the test programs */
+
+#ifndef TESTCHECK_H
+#define TESTCHECK_H
+
+#include <cstdint>
+#include <cstdio>
+
+// failed checks so far, main returns it
+extern int m_testFailures;
+
+#define CHECK(cond) { if(!(cond)) { fprintf(stderr, "%s(%d): CHECK(%s) failed\n", __FILE__, __LINE__, #cond); m_testFailures++; } }
+#define CHECK_EQ(a, b) { long long _a = (long long)(a), _b = (long long)(b); \
+    if(_a != _b) { fprintf(stderr, "%s(%d): CHECK_EQ(%s, %s) failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, _a, _b); m_testFailures++; } }
+
+// Connects to the stub SDK with a callback that hands property changes to
+// the property cache and DeviceProperty, and PTZ warnings to m_ptz, the way
+// RemoteCli's event handler does. The cache is loaded when it returns.
+void testConnect();
+// delivers the events still on their way, then disconnects
+void testDisconnect();
+
+// steady clock, ms since the first call
+double testNowMs();
+
+#endif // TESTCHECK_H
@@ -0,0 +1,71 @@
+#include "TestCheck.h"
+
+#include <chrono>
+#include <future>
+#include <string>
+
+#include "CrSdkStub.h"
+#include "DeviceProperty.h"
+#include "PropertyCache.h"
+#include "PtzControl.h"
+#include "RemoteCli.h"
+
+// what RemoteCli.cpp defines for the modules
+bool  m_connected = false;
+std::string m_modelId = "stub";
+int64_t  m_device_handle = 0;
+
+int m_testFailures = 0;
+
+// Handles the events on the stub's threads, the tests do not need the
+// dispatcher in between.
+class TestCallback : public SCRSDK::IDeviceCallback
+{
+public:
+    std::promise<void> connected;
+
+    void OnConnected(SCRSDK::DeviceConnectionVersioin version)
+    {
+        m_connected = true;
+        connected.set_value();
+    }
+    void OnDisconnected(CrInt32u error)
+    {
+        m_connected = false;
+        m_propCache.clear();
+        propertyWaitersAbort(SCRSDK::CrError_Connect_Disconnected);
+        m_ptz.abortMoves(SCRSDK::CrError_Connect_Disconnected);
+    }
+    void OnWarningExt(CrInt32u warning, CrInt32 param1, CrInt32 param2, CrInt32 param3)
+    {
+        m_ptz.warningExt(warning, param1, param2, param3);
+    }
+    void OnPropertyChangedCodes(CrInt32u num, CrInt32u* codes)
+    {
+        m_propCache.refresh(m_device_handle, num, codes);
+        propertyChanged(num, codes);
+    }
+};
+
+static TestCallback m_testCallback;
+
+void testConnect()
+{
+    SCRSDK::Connect(nullptr, &m_testCallback, &m_device_handle, SCRSDK::CrSdkControlMode_Remote,
+        SCRSDK::CrReconnecting_ON, nullptr, nullptr, nullptr, 0);
+    m_testCallback.connected.get_future().wait();
+    m_propCache.load(m_device_handle);
+    m_ptz.start(m_device_handle);
+}
+
+void testDisconnect()
+{
+    m_ptz.stop();
+    SCRSDK::Disconnect(m_device_handle);
+}
+
+double testNowMs()
+{
+    static const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
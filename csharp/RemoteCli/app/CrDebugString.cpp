@@ -1,38 +1,107 @@
-#include <unordered_map>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <CrDefines.h>
 #include "CrDebugString.h"
 
-static std::string getMapString(const std::unordered_map<CrInt32, std::string>* _map, CrInt32 code)
+// The tables are constexpr arrays sorted by code, so nothing is built at
+// startup and a lookup is a binary search. Tables looked up by name have a
+// second copy sorted by name. Both orders, and that the two copies hold the
+// same pairs, are checked at compile time.
+struct CrCodeName
 {
-	if(_map == NULL) {
+	// the sdk enums mix signed and unsigned, stored as CrInt32 like the callbacks report them
+	constexpr CrCodeName(CrInt64 code, std::string_view name) : code((CrInt32)code), name(name) {}
+	CrInt32 code;
+	std::string_view name;
+};
+
+struct CrCodeTable
+{
+	const CrCodeName* entries;
+	size_t size;
+};
+
+template<size_t N>
+static constexpr CrCodeTable makeTable(const CrCodeName (&entries)[N])
+{
+	return { entries, N };
+}
+
+template<typename T, size_t N>
+static constexpr bool isSortedByCode(const T (&entries)[N])
+{
+	for(size_t i = 1; i < N; i++) {
+		if(!(entries[i - 1].code < entries[i].code)) return false;
+	}
+	return true;
+}
+
+template<size_t N>
+static constexpr bool isSortedByName(const CrCodeName (&entries)[N])
+{
+	for(size_t i = 1; i < N; i++) {
+		if(!(entries[i - 1].name < entries[i].name)) return false;
+	}
+	return true;
+}
+
+template<typename T>
+static constexpr const T* findCode(const T* entries, size_t size, CrInt32 code)
+{
+	size_t lo = 0, hi = size;
+	while(lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if(entries[mid].code < code) lo = mid + 1;
+		else hi = mid;
+	}
+	return (lo < size && entries[lo].code == code) ? &entries[lo] : NULL;
+}
+
+// byName holds exactly the pairs of byCode, so a name maps back to its code
+template<size_t N, size_t M>
+static constexpr bool isSameTable(const CrCodeName (&byCode)[N], const CrCodeName (&byName)[M])
+{
+	if(N != M) return false;
+	for(size_t i = 0; i < M; i++) {
+		const CrCodeName* entry = findCode(byCode, N, byName[i].code);
+		if(entry == NULL || entry->name != byName[i].name) return false;
+	}
+	return true;
+}
+
+static std::string getMapString(CrCodeTable table, CrInt32 code)
+{
+	if(table.entries == NULL) {
 		return "";
 	}
 
-	auto iter = _map->find(code);
-	if(iter == end(*_map)) {
+	const CrCodeName* entry = findCode(table.entries, table.size, code);
+	if(entry == NULL) {
 		char tmp[64] = {0};
 		snprintf(tmp, sizeof(tmp), "unknown(0x%x)", code);
 		std::string tmp2(tmp);
 		return tmp2;
 	}
-	return iter->second;
+	return std::string(entry->name);
 }
 
-static CrInt32 getMapCode(const std::unordered_map<CrInt32, std::string>* _map, std::string name)
+// byName is a table sorted by name
+static CrInt32 getMapCode(CrCodeTable byName, std::string_view name)
 {
-	if(_map == NULL) {
-		return -1;
+	size_t lo = 0, hi = byName.size;
+	while(lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if(byName.entries[mid].name < name) lo = mid + 1;
+		else hi = mid;
 	}
-
-	for (const auto& pair : *_map) {
-		if(pair.second == name)
-			return pair.first;
+	if(lo < byName.size && byName.entries[lo].name == name) {
+		return byName.entries[lo].code;
 	}
 	return -1;
 }
 
-const std::unordered_map<CrInt32, std::string> map_CrCommandId
+static constexpr CrCodeName map_CrCommandId[] =
 {
 //	{ SCRSDK::CrCommandId_\1,"\1" },
 	{ SCRSDK::CrCommandId_Release,"Release" },
@@ -64,6 +133,11 @@ const std::unordered_map<CrInt32, std::string> map_CrCommandId
 	{ SCRSDK::CrCommandId_CameraStandBy,"CameraStandBy" },
 	{ SCRSDK::CrCommandId_PowerOn,"PowerOn" },
 	{ SCRSDK::CrCommandId_StreamButton,"StreamButton" },
+	{ SCRSDK::CrCommandId_ResetMultiMatrix,"ResetMultiMatrix" },
+	{ SCRSDK::CrCommandId_RemoteKeyUp,"RemoteKeyUp" },
+	{ SCRSDK::CrCommandId_RemoteKeyDown,"RemoteKeyDown" },
+	{ SCRSDK::CrCommandId_RemoteKeyLeft,"RemoteKeyLeft" },
+	{ SCRSDK::CrCommandId_RemoteKeyRight,"RemoteKeyRight" },
 	{ SCRSDK::CrCommandId_RemoteKeyCancelBackButton,"RemoteKeyCancelBackButton" },
 	{ SCRSDK::CrCommandId_RemoteKeyDisplayButton,"RemoteKeyDisplayButton" },
 	{ SCRSDK::CrCommandId_RemoteKeySet,"RemoteKeySet" },
@@ -72,24 +146,70 @@ const std::unordered_map<CrInt32, std::string> map_CrCommandId
 	{ SCRSDK::CrCommandId_RemoteKeyLeftUp,"RemoteKeyLeftUp" },
 	{ SCRSDK::CrCommandId_RemoteKeyLeftDown,"RemoteKeyLeftDown" },
 	{ SCRSDK::CrCommandId_RemoteKeyMenuButton,"RemoteKeyMenuButton" },
-	{ SCRSDK::CrCommandId_ResetMultiMatrix,"ResetMultiMatrix" },
-	{ SCRSDK::CrCommandId_RemoteKeyUp,"RemoteKeyUp" },
+};
+static_assert(isSortedByCode(map_CrCommandId), "map_CrCommandId must be sorted by code");
+
+// same entries sorted by name for the reverse lookup
+static constexpr CrCodeName map_CrCommandIdName[] =
+{
+//	{ SCRSDK::CrCommandId_\1,"\1" },
+	{ SCRSDK::CrCommandId_APS_C_or_Full_Switching,"APS_C_or_Full_Switching" },
+	{ SCRSDK::CrCommandId_CameraSettingsReset,"CameraSettingsReset" },
+	{ SCRSDK::CrCommandId_CameraStandBy,"CameraStandBy" },
+	{ SCRSDK::CrCommandId_CancelContentsTransfer,"CancelContentsTransfer" },
+	{ SCRSDK::CrCommandId_CancelFocusPosition,"CancelFocusPosition" },
+	{ SCRSDK::CrCommandId_CancelMediaFormat,"CancelMediaFormat" },
+	{ SCRSDK::CrCommandId_CancelRemoteTouchOperation,"CancelRemoteTouchOperation" },
+	{ SCRSDK::CrCommandId_CancelShooting,"CancelShooting" },
+	{ SCRSDK::CrCommandId_CancelZoomPosition,"CancelZoomPosition" },
+	{ SCRSDK::CrCommandId_ContinuousShootingSpotBoost,"ContinuousShootingSpotBoost" },
+	{ SCRSDK::CrCommandId_CreativeLookReset,"CreativeLookReset" },
+	{ SCRSDK::CrCommandId_FlickerScan,"FlickerScan" },
+	{ SCRSDK::CrCommandId_ForcedFileNumberReset,"ForcedFileNumberReset" },
+	{ SCRSDK::CrCommandId_MediaFormat,"MediaFormat" },
+	{ SCRSDK::CrCommandId_MediaQuickFormat,"MediaQuickFormat" },
+	{ SCRSDK::CrCommandId_MovieRecButtonToggle,"MovieRecButtonToggle" },
+	{ SCRSDK::CrCommandId_MovieRecButtonToggle2,"MovieRecButtonToggle2" },
+	{ SCRSDK::CrCommandId_MovieRecord,"MovieRecord" },
+	{ SCRSDK::CrCommandId_PictureProfileReset,"PictureProfileReset" },
+	{ SCRSDK::CrCommandId_PixelMapping,"PixelMapping" },
+	{ SCRSDK::CrCommandId_PowerOff,"PowerOff" },
+	{ SCRSDK::CrCommandId_PowerOn,"PowerOn" },
+	{ SCRSDK::CrCommandId_Release,"Release" },
+	{ SCRSDK::CrCommandId_RemoteKeyCancelBackButton,"RemoteKeyCancelBackButton" },
+	{ SCRSDK::CrCommandId_RemoteKeyDisplayButton,"RemoteKeyDisplayButton" },
 	{ SCRSDK::CrCommandId_RemoteKeyDown,"RemoteKeyDown" },
 	{ SCRSDK::CrCommandId_RemoteKeyLeft,"RemoteKeyLeft" },
+	{ SCRSDK::CrCommandId_RemoteKeyLeftDown,"RemoteKeyLeftDown" },
+	{ SCRSDK::CrCommandId_RemoteKeyLeftUp,"RemoteKeyLeftUp" },
+	{ SCRSDK::CrCommandId_RemoteKeyMenuButton,"RemoteKeyMenuButton" },
 	{ SCRSDK::CrCommandId_RemoteKeyRight,"RemoteKeyRight" },
+	{ SCRSDK::CrCommandId_RemoteKeyRightDown,"RemoteKeyRightDown" },
+	{ SCRSDK::CrCommandId_RemoteKeyRightUp,"RemoteKeyRightUp" },
+	{ SCRSDK::CrCommandId_RemoteKeySet,"RemoteKeySet" },
+	{ SCRSDK::CrCommandId_RemoteKeyUp,"RemoteKeyUp" },
+	{ SCRSDK::CrCommandId_ResetMultiMatrix,"ResetMultiMatrix" },
+	{ SCRSDK::CrCommandId_S1andRelease,"S1andRelease" },
+	{ SCRSDK::CrCommandId_SensorCleaning,"SensorCleaning" },
+	{ SCRSDK::CrCommandId_StreamButton,"StreamButton" },
+	{ SCRSDK::CrCommandId_TimeCodePresetReset,"TimeCodePresetReset" },
+	{ SCRSDK::CrCommandId_TrackingOnAndAFOn,"TrackingOnAndAFOn" },
+	{ SCRSDK::CrCommandId_UserBitPresetReset,"UserBitPresetReset" },
 };
+static_assert(isSortedByName(map_CrCommandIdName), "map_CrCommandIdName must be sorted by name");
+static_assert(isSameTable(map_CrCommandId, map_CrCommandIdName), "map_CrCommandIdName must hold the pairs of map_CrCommandId");
 
 std::string CrCommandIdString(SCRSDK::CrCommandId id)
 {
-	return getMapString(&map_CrCommandId, (CrInt32)id);
+	return getMapString(makeTable(map_CrCommandId), (CrInt32)id);
 }
 
-SCRSDK::CrCommandId CrCommandIdCode(std::string name)
+SCRSDK::CrCommandId CrCommandIdCode(std::string_view name)
 {
-	return (SCRSDK::CrCommandId)getMapCode(&map_CrCommandId, name);
+	return (SCRSDK::CrCommandId)getMapCode(makeTable(map_CrCommandIdName), name);
 }
 
-const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
+static constexpr CrCodeName map_CrDeviceProperty[] =
 {
 //	{ SCRSDK::CrDeviceProperty_\1,"\1" },
 	{ SCRSDK::CrDeviceProperty_Undefined,"Undefined" },
@@ -564,11 +684,9 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_TiltLimitMode,"TiltLimitMode" },
 	{ SCRSDK::CrDeviceProperty_TiltLimitRangeMinimum,"TiltLimitRangeMinimum" },
 	{ SCRSDK::CrDeviceProperty_TiltLimitRangeMaximum,"TiltLimitRangeMaximum" },
-	{ SCRSDK::CrDeviceProperty_TargetStreamingDestinationSelect,"TargetStreamingDestinationSelect" },
+	{ SCRSDK::CrDeviceProperty_PresetPTZFSlotNumber,"PresetPTZFSlotNumber" },
 	{ SCRSDK::CrDeviceProperty_IRRemoteSetting,"IRRemoteSetting" },
 	{ SCRSDK::CrDeviceProperty_IPSetupProtocolSetting,"IPSetupProtocolSetting" },
-	{ SCRSDK::CrDeviceProperty_PresetPTZFSlotNumber,"PresetPTZFSlotNumber" },
-	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixAreaIndication,"PaintLookMultiMatrixAreaIndication" },
 	{ SCRSDK::CrDeviceProperty_IrisCloseSetting,"IrisCloseSetting" },
 	{ SCRSDK::CrDeviceProperty_LanguageSetting,"LanguageSetting" },
 	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixSetting,"PaintLookUserMatrixSetting" },
@@ -584,8 +702,7 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixAxis,"PaintLookMultiMatrixAxis" },
 	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixHue,"PaintLookMultiMatrixHue" },
 	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixSaturation,"PaintLookMultiMatrixSaturation" },
-	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting1,"MonitoringOutputDisplaySetting1" },
-	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting2,"MonitoringOutputDisplaySetting2" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixAreaIndication,"PaintLookMultiMatrixAreaIndication" },
 	{ SCRSDK::CrDeviceProperty_AudioInputCH1LevelControl,"AudioInputCH1LevelControl" },
 	{ SCRSDK::CrDeviceProperty_AudioInputCH2LevelControl,"AudioInputCH2LevelControl" },
 	{ SCRSDK::CrDeviceProperty_AudioInputCH3LevelControl,"AudioInputCH3LevelControl" },
@@ -602,14 +719,16 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_AudioInputCH2WindFilter,"AudioInputCH2WindFilter" },
 	{ SCRSDK::CrDeviceProperty_AudioInputCH3WindFilter,"AudioInputCH3WindFilter" },
 	{ SCRSDK::CrDeviceProperty_AudioInputCH4WindFilter,"AudioInputCH4WindFilter" },
+	{ SCRSDK::CrDeviceProperty_AudioInput1TypeSelect,"AudioInput1TypeSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInput2TypeSelect,"AudioInput2TypeSelect" },
 	{ SCRSDK::CrDeviceProperty_RemoteKeyThumbnailButton,"RemoteKeyThumbnailButton" },
 	{ SCRSDK::CrDeviceProperty_RemoteKeySLOTSelectButton,"RemoteKeySLOTSelectButton" },
 	{ SCRSDK::CrDeviceProperty_VideoRecordingFormatBitrateSetting,"VideoRecordingFormatBitrateSetting" },
+	{ SCRSDK::CrDeviceProperty_VideoRecordingFormatQuality,"VideoRecordingFormatQuality" },
 	{ SCRSDK::CrDeviceProperty_MonitoringOutputFormat,"MonitoringOutputFormat" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting1,"MonitoringOutputDisplaySetting1" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting2,"MonitoringOutputDisplaySetting2" },
 	{ SCRSDK::CrDeviceProperty_FocusSpeedDirectSync,"FocusSpeedDirectSync" },
-	{ SCRSDK::CrDeviceProperty_AudioInput1TypeSelect,"AudioInput1TypeSelect" },
-	{ SCRSDK::CrDeviceProperty_AudioInput2TypeSelect,"AudioInput2TypeSelect" },
-	{ SCRSDK::CrDeviceProperty_VideoRecordingFormatQuality,"VideoRecordingFormatQuality" },
 	{ SCRSDK::CrDeviceProperty_LiveViewImageQualityByNumericalValue,"LiveViewImageQualityByNumericalValue" },
 	{ SCRSDK::CrDeviceProperty_TallyLampControlRed,"TallyLampControlRed" },
 	{ SCRSDK::CrDeviceProperty_TallyLampControlGreen,"TallyLampControlGreen" },
@@ -617,12 +736,12 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_ZoomOperationWithInt16,"ZoomOperationWithInt16" },
 	{ SCRSDK::CrDeviceProperty_FocusOperationWithInt16,"FocusOperationWithInt16" },
 	{ SCRSDK::CrDeviceProperty_Movie_RecordingResolutionForRTSP,"Movie_RecordingResolutionForRTSP" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingResolutionForRAW,"Movie_RecordingResolutionForRAW" },
 	{ SCRSDK::CrDeviceProperty_Movie_RecordingFrameRateRTSPSetting,"Movie_RecordingFrameRateRTSPSetting" },
 	{ SCRSDK::CrDeviceProperty_PictureCacheRecSetting,"PictureCacheRecSetting" },
 	{ SCRSDK::CrDeviceProperty_PictureCacheRecSizeAndTime,"PictureCacheRecSizeAndTime" },
 	{ SCRSDK::CrDeviceProperty_Movie_IntervalRecFrames,"Movie_IntervalRecFrames" },
 	{ SCRSDK::CrDeviceProperty_ImagerScanMode,"ImagerScanMode" },
-	{ SCRSDK::CrDeviceProperty_Movie_RecordingResolutionForRAW,"Movie_RecordingResolutionForRAW" },
 	{ SCRSDK::CrDeviceProperty_ShootingEnableSettingLicense,"ShootingEnableSettingLicense" },
 	{ SCRSDK::CrDeviceProperty_GridLineDisplayPlayback,"GridLineDisplayPlayback" },
 	{ SCRSDK::CrDeviceProperty_GridLineType,"GridLineType" },
@@ -630,8 +749,9 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_ManualInputForNDFilterValue,"ManualInputForNDFilterValue" },
 	{ SCRSDK::CrDeviceProperty_LogShootingMode,"LogShootingMode" },
 	{ SCRSDK::CrDeviceProperty_LogShootingModeColorGamut,"LogShootingModeColorGamut" },
-	{ SCRSDK::CrDeviceProperty_VideoStreamSelect,"VideoStreamSelect" },
+	{ SCRSDK::CrDeviceProperty_TargetStreamingDestinationSelect,"TargetStreamingDestinationSelect" },
 	{ SCRSDK::CrDeviceProperty_StreamDisplayName,"StreamDisplayName" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamSelect,"VideoStreamSelect" },
 	{ SCRSDK::CrDeviceProperty_VideoStreamResolution,"VideoStreamResolution" },
 	{ SCRSDK::CrDeviceProperty_VideoStreamMaxBitRate,"VideoStreamMaxBitRate" },
 	{ SCRSDK::CrDeviceProperty_VideoStreamAdaptiveRateControl,"VideoStreamAdaptiveRateControl" },
@@ -655,10 +775,11 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_EframingTrackingStartMode,"EframingTrackingStartMode" },
 	{ SCRSDK::CrDeviceProperty_EframingProductionEffect,"EframingProductionEffect" },
 	{ SCRSDK::CrDeviceProperty_EframingSpeedPTZ,"EframingSpeedPTZ" },
+	{ SCRSDK::CrDeviceProperty_DigitalExtenderMagnificationSetting,"DigitalExtenderMagnificationSetting" },
+	{ SCRSDK::CrDeviceProperty_MovieRecReviewPlayingState,"MovieRecReviewPlayingState" },
 	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeedAdjust,"HighResolutionShutterSpeedAdjust" },
 	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeedAdjustInIntegralMultiples,"HighResolutionShutterSpeedAdjustInIntegralMultiples" },
 	{ SCRSDK::CrDeviceProperty_TopOfTheGroupShootingMarkSetting,"TopOfTheGroupShootingMarkSetting" },
-	{ SCRSDK::CrDeviceProperty_DigitalExtenderMagnificationSetting,"DigitalExtenderMagnificationSetting" },
 	{ SCRSDK::CrDeviceProperty_S2,"S2" },
 	{ SCRSDK::CrDeviceProperty_reserved10,"reserved10" },
 	{ SCRSDK::CrDeviceProperty_reserved11,"reserved11" },
@@ -672,6 +793,7 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_CustomWB_Capture_Standby_Cancel,"CustomWB_Capture_Standby_Cancel" },
 	{ SCRSDK::CrDeviceProperty_CustomWB_Capture,"CustomWB_Capture" },
 	{ SCRSDK::CrDeviceProperty_Remocon_Zoom_Speed_Type,"Remocon_Zoom_Speed_Type" },
+	{ SCRSDK::CrDeviceProperty_LiveViewProtocol,"LiveViewProtocol" },
 	{ SCRSDK::CrDeviceProperty_SnapshotInfo,"SnapshotInfo" },
 	{ SCRSDK::CrDeviceProperty_BatteryRemain,"BatteryRemain" },
 	{ SCRSDK::CrDeviceProperty_BatteryLevel,"BatteryLevel" },
@@ -851,16 +973,14 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_FirmwareUpdateCommandVersion,"FirmwareUpdateCommandVersion" },
 	{ SCRSDK::CrDeviceProperty_ModelName,"ModelName" },
 	{ SCRSDK::CrDeviceProperty_AutoRecognitionTargetCandidates,"AutoRecognitionTargetCandidates" },
+	{ SCRSDK::CrDeviceProperty_AreaTimeZoneSettingVersion,"AreaTimeZoneSettingVersion" },
 	{ SCRSDK::CrDeviceProperty_SetPresetPTZFBinaryVersion,"SetPresetPTZFBinaryVersion" },
 	{ SCRSDK::CrDeviceProperty_PanPositionStatus,"PanPositionStatus" },
 	{ SCRSDK::CrDeviceProperty_TiltPositionStatus,"TiltPositionStatus" },
 	{ SCRSDK::CrDeviceProperty_PanPositionCurrentValue,"PanPositionCurrentValue" },
 	{ SCRSDK::CrDeviceProperty_TiltPositionCurrentValue,"TiltPositionCurrentValue" },
 	{ SCRSDK::CrDeviceProperty_CameraPowerStatus,"CameraPowerStatus" },
-	{ SCRSDK::CrDeviceProperty_StreamStatus,"StreamStatus" },
 	{ SCRSDK::CrDeviceProperty_RecordablePowerSources,"RecordablePowerSources" },
-	{ SCRSDK::CrDeviceProperty_StreamSettingListOperationStatus,"StreamSettingListOperationStatus" },
-	{ SCRSDK::CrDeviceProperty_AreaTimeZoneSettingVersion,"AreaTimeZoneSettingVersion" },
 	{ SCRSDK::CrDeviceProperty_DisplayedMenuStatus,"DisplayedMenuStatus" },
 	{ SCRSDK::CrDeviceProperty_PlaybackContentsRecordingDateTime,"PlaybackContentsRecordingDateTime" },
 	{ SCRSDK::CrDeviceProperty_PlaybackContentsName,"PlaybackContentsName" },
@@ -877,166 +997,973 @@ const std::unordered_map<CrInt32, std::string> map_CrDeviceProperty
 	{ SCRSDK::CrDeviceProperty_FocusOperationWithInt16EnableStatus,"FocusOperationWithInt16EnableStatus" },
 	{ SCRSDK::CrDeviceProperty_ValidRecordingVideoFormat,"ValidRecordingVideoFormat" },
 	{ SCRSDK::CrDeviceProperty_LensSerialNumber,"LensSerialNumber" },
-	{ SCRSDK::CrDeviceProperty_CustomGridLineFileCommandVersion,"CustomGridLineFileCommandVersion" },
 	{ SCRSDK::CrDeviceProperty_MaximumSizeOfImageIDString,"MaximumSizeOfImageIDString" },
+	{ SCRSDK::CrDeviceProperty_StreamStatus,"StreamStatus" },
+	{ SCRSDK::CrDeviceProperty_StreamSettingListOperationStatus,"StreamSettingListOperationStatus" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamSettingVersion,"VideoStreamSettingVersion" },
+	{ SCRSDK::CrDeviceProperty_EframingType,"EframingType" },
+	{ SCRSDK::CrDeviceProperty_EframingCommandVersion,"EframingCommandVersion" },
 	{ SCRSDK::CrDeviceProperty_DeleteContentOperationEnableStatusSLOT1,"DeleteContentOperationEnableStatusSLOT1" },
 	{ SCRSDK::CrDeviceProperty_DeleteContentOperationEnableStatusSLOT2,"DeleteContentOperationEnableStatusSLOT2" },
 	{ SCRSDK::CrDeviceProperty_SceneFileCommandVersion,"SceneFileCommandVersion" },
 	{ SCRSDK::CrDeviceProperty_SceneFileUploadOperationEnableStatus,"SceneFileUploadOperationEnableStatus" },
 	{ SCRSDK::CrDeviceProperty_SceneFileDownloadOperationEnableStatus,"SceneFileDownloadOperationEnableStatus" },
 	{ SCRSDK::CrDeviceProperty_SceneFileIndexesAvailableForDownload,"SceneFileIndexesAvailableForDownload" },
-	{ SCRSDK::CrDeviceProperty_EframingType,"EframingType" },
-	{ SCRSDK::CrDeviceProperty_EframingCommandVersion,"EframingCommandVersion" },
-	{ SCRSDK::CrDeviceProperty_VideoStreamSettingVersion,"VideoStreamSettingVersion" },
-	{ SCRSDK::CrDeviceProperty_LiveViewProtocol,"LiveViewProtocol" },
-	{ SCRSDK::CrDeviceProperty_MovieRecReviewPlayingState,"MovieRecReviewPlayingState" },
+	{ SCRSDK::CrDeviceProperty_CustomGridLineFileCommandVersion,"CustomGridLineFileCommandVersion" },
 };
+static_assert(isSortedByCode(map_CrDeviceProperty), "map_CrDeviceProperty must be sorted by code");
 
-std::string CrDevicePropertyString(SCRSDK::CrDevicePropertyCode code)
-{
-	return getMapString(&map_CrDeviceProperty, (CrInt32)code);
-}
-
-SCRSDK::CrDevicePropertyCode CrDevicePropertyCode(std::string name)
+// same entries sorted by name for the reverse lookup
+static constexpr CrCodeName map_CrDevicePropertyName[] =
 {
-	return (SCRSDK::CrDevicePropertyCode)getMapCode(&map_CrDeviceProperty, name);
-}
-
-const std::unordered_map<CrInt32, std::string> map_CrError
-{
-//	{ SCRSDK::CrError_\1,"\1" },
-	{ SCRSDK::CrError_None,"None" },
-	{ SCRSDK::CrError_Generic_Unknown,"Generic_Unknown" },
-	{ SCRSDK::CrError_Generic_Notimpl,"Generic_Notimpl" },
-	{ SCRSDK::CrError_Generic_Abort,"Generic_Abort" },
-	{ SCRSDK::CrError_Generic_NotSupported,"Generic_NotSupported" },
-	{ SCRSDK::CrError_Generic_SeriousErrorNotSupported,"Generic_SeriousErrorNotSupported" },
-	{ SCRSDK::CrError_Generic_InvalidHandle,"Generic_InvalidHandle" },
-	{ SCRSDK::CrError_Generic_InvalidParameter,"Generic_InvalidParameter" },
-	{ SCRSDK::CrError_File_Unknown,"File_Unknown" },
-	{ SCRSDK::CrError_File_IllegalOperation,"File_IllegalOperation" },
-	{ SCRSDK::CrError_File_IllegalParameter,"File_IllegalParameter" },
-	{ SCRSDK::CrError_File_EOF,"File_EOF" },
-	{ SCRSDK::CrError_File_OutOfRange,"File_OutOfRange" },
-	{ SCRSDK::CrError_File_NotFound,"File_NotFound" },
-	{ SCRSDK::CrError_File_DirNotFound,"File_DirNotFound" },
-	{ SCRSDK::CrError_File_AlreadyOpened,"File_AlreadyOpened" },
-	{ SCRSDK::CrError_File_PermissionDenied,"File_PermissionDenied" },
-	{ SCRSDK::CrError_File_StorageFull,"File_StorageFull" },
-	{ SCRSDK::CrError_File_AlreadyExists,"File_AlreadyExists" },
-	{ SCRSDK::CrError_File_TooManyOpenedFiles,"File_TooManyOpenedFiles" },
-	{ SCRSDK::CrError_File_ReadOnly,"File_ReadOnly" },
-	{ SCRSDK::CrError_File_CantOpen,"File_CantOpen" },
-	{ SCRSDK::CrError_File_CantClose,"File_CantClose" },
-	{ SCRSDK::CrError_File_CantDelete,"File_CantDelete" },
-	{ SCRSDK::CrError_File_CantRead,"File_CantRead" },
-	{ SCRSDK::CrError_File_CantWrite,"File_CantWrite" },
-	{ SCRSDK::CrError_File_CantCreateDir,"File_CantCreateDir" },
-	{ SCRSDK::CrError_File_OperationAbortedByUser,"File_OperationAbortedByUser" },
-	{ SCRSDK::CrError_File_UnsupportedOperation,"File_UnsupportedOperation" },
-	{ SCRSDK::CrError_File_NotYetCompleted,"File_NotYetCompleted" },
-	{ SCRSDK::CrError_File_Invalid,"File_Invalid" },
-	{ SCRSDK::CrError_File_StorageNotExist,"File_StorageNotExist" },
-	{ SCRSDK::CrError_File_SharingViolation,"File_SharingViolation" },
-	{ SCRSDK::CrError_File_Rotation,"File_Rotation" },
-	{ SCRSDK::CrError_File_SameNameFull,"File_SameNameFull" },
-	{ SCRSDK::CrError_Connect_Unknown,"Connect_Unknown" },
-	{ SCRSDK::CrError_Connect_Connect,"Connect_Connect" },
-	{ SCRSDK::CrError_Connect_ConnectIP,"Connect_ConnectIP" },
-	{ SCRSDK::CrError_Connect_Release,"Connect_Release" },
-	{ SCRSDK::CrError_Connect_GetProperty,"Connect_GetProperty" },
-	{ SCRSDK::CrError_Connect_SendCommand,"Connect_SendCommand" },
-	{ SCRSDK::CrError_Connect_HandlePlugin,"Connect_HandlePlugin" },
-	{ SCRSDK::CrError_Connect_Disconnected,"Connect_Disconnected" },
-	{ SCRSDK::CrError_Connect_TimeOut,"Connect_TimeOut" },
-	{ SCRSDK::CrError_Reconnect_TimeOut,"Reconnect_TimeOut" },
-	{ SCRSDK::CrError_Connect_FailRejected,"Connect_FailRejected" },
-	{ SCRSDK::CrError_Connect_FailBusy,"Connect_FailBusy" },
-	{ SCRSDK::CrError_Connect_FailUnspecified,"Connect_FailUnspecified" },
-	{ SCRSDK::CrError_Connect_Cancel,"Connect_Cancel" },
-	{ SCRSDK::CrError_Reserved1,"Reserved1" },
-	{ SCRSDK::CrError_Reserved2,"Reserved2" },
-	{ SCRSDK::CrError_Connect_SessionAlreadyOpened,"Connect_SessionAlreadyOpened" },
-	{ SCRSDK::CrError_Connect_ContentsTransfer_NotSupported,"Connect_ContentsTransfer_NotSupported" },
-	{ SCRSDK::CrError_Connect_SSH_NotSupported,"Connect_SSH_NotSupported" },
-	{ SCRSDK::CrError_Connect_SSH_InvalidParameter,"Connect_SSH_InvalidParameter" },
-	{ SCRSDK::CrError_Connect_SSH_ServerConnectFailed,"Connect_SSH_ServerConnectFailed" },
-	{ SCRSDK::CrError_Connect_SSH_ServerAuthenticationFailed,"Connect_SSH_ServerAuthenticationFailed" },
-	{ SCRSDK::CrError_Connect_SSH_UserAuthenticationFailed,"Connect_SSH_UserAuthenticationFailed" },
-	{ SCRSDK::CrError_Connect_SSH_PortForwardFailed,"Connect_SSH_PortForwardFailed" },
-	{ SCRSDK::CrError_Connect_SSH_GetFingerprintFailed,"Connect_SSH_GetFingerprintFailed" },
-	{ SCRSDK::CrError_Connect_RemoteTransfer_NotSupported,"Connect_RemoteTransfer_NotSupported" },
-	{ SCRSDK::CrError_Memory_Unknown,"Memory_Unknown" },
-	{ SCRSDK::CrError_Memory_OutOfMemory,"Memory_OutOfMemory" },
-	{ SCRSDK::CrError_Memory_InvalidPointer,"Memory_InvalidPointer" },
-	{ SCRSDK::CrError_Memory_Insufficient,"Memory_Insufficient" },
-	{ SCRSDK::CrError_Api_Unknown,"Api_Unknown" },
-	{ SCRSDK::CrError_Api_Insufficient,"Api_Insufficient" },
-	{ SCRSDK::CrError_Api_InvalidCalled,"Api_InvalidCalled" },
-	{ SCRSDK::CrError_Api_NoApplicableInformation,"Api_NoApplicableInformation" },
-	{ SCRSDK::CrError_Api_OutOfModelList,"Api_OutOfModelList" },
-	{ SCRSDK::CrError_Api_NotSupportModelOfUSB,"Api_NotSupportModelOfUSB" },
-	{ SCRSDK::CrError_Api_NotSupportModelOfEthernet,"Api_NotSupportModelOfEthernet" },
-	{ SCRSDK::CrError_Api_InvalidSerialNumber,"Api_InvalidSerialNumber" },
-	{ SCRSDK::CrError_Api_InvalidIpAddress,"Api_InvalidIpAddress" },
-	{ SCRSDK::CrError_Api_InvalidMacAddress,"Api_InvalidMacAddress" },
-	{ SCRSDK::CrError_Api_PasswordLengthOverMax,"Api_PasswordLengthOverMax" },
-	{ SCRSDK::CrError_Api_PasswordIncludesInvalidCharacter,"Api_PasswordIncludesInvalidCharacter" },
-	{ SCRSDK::CrError_Polling_Unknown,"Polling_Unknown" },
-	{ SCRSDK::CrError_Polling_InvalidVal_Intervals,"Polling_InvalidVal_Intervals" },
-	{ SCRSDK::CrError_Adaptor_Unknown,"Adaptor_Unknown" },
-	{ SCRSDK::CrError_Adaptor_InvalidProperty,"Adaptor_InvalidProperty" },
-	{ SCRSDK::CrError_Adaptor_GetInfo,"Adaptor_GetInfo" },
-	{ SCRSDK::CrError_Adaptor_Create,"Adaptor_Create" },
-	{ SCRSDK::CrError_Adaptor_SendCommand,"Adaptor_SendCommand" },
-	{ SCRSDK::CrError_Adaptor_HandlePlugin,"Adaptor_HandlePlugin" },
-	{ SCRSDK::CrError_Adaptor_CreateDevice,"Adaptor_CreateDevice" },
-	{ SCRSDK::CrError_Adaptor_EnumDevice,"Adaptor_EnumDevice" },
-	{ SCRSDK::CrError_Adaptor_Reset,"Adaptor_Reset" },
-	{ SCRSDK::CrError_Adaptor_Read,"Adaptor_Read" },
-	{ SCRSDK::CrError_Adaptor_Phase,"Adaptor_Phase" },
-	{ SCRSDK::CrError_Adaptor_DataToWiaItem,"Adaptor_DataToWiaItem" },
-	{ SCRSDK::CrError_Adaptor_DeviceBusy,"Adaptor_DeviceBusy" },
-	{ SCRSDK::CrError_Adaptor_Escape,"Adaptor_Escape" },
-	{ SCRSDK::CrError_Adaptor_InvalidParameter,"Adaptor_InvalidParameter" },
-	{ SCRSDK::CrError_Adaptor_FeatureVersionInvalidValue,"Adaptor_FeatureVersionInvalidValue" },
-	{ SCRSDK::CrError_Adaptor_TemporaryStorageFull,"Adaptor_TemporaryStorageFull" },
-	{ SCRSDK::CrError_Adaptor_CameraStatusError,"Adaptor_CameraStatusError" },
-	{ SCRSDK::CrError_Device_Unknown,"Device_Unknown" },
-	{ SCRSDK::CrError_Contents_Unknown,"Contents_Unknown" },
-	{ SCRSDK::CrError_Contents_Reserved1,"Contents_Reserved1" },
-	{ SCRSDK::CrError_Contents_InvalidHandle,"Contents_InvalidHandle" },
-	{ SCRSDK::CrError_Contents_DateFolderList_NotRetrieved,"Contents_DateFolderList_NotRetrieved" },
-	{ SCRSDK::CrError_Contents_ContentsList_NotRetrieved,"Contents_ContentsList_NotRetrieved" },
-	{ SCRSDK::CrError_Contents_Transfer_Unsuccess,"Contents_Transfer_Unsuccess" },
-	{ SCRSDK::CrError_Contents_Transfer_Cancel,"Contents_Transfer_Cancel" },
-	{ SCRSDK::CrError_Contents_RejectRequest,"Contents_RejectRequest" },
-	{ SCRSDK::CrError_RemoteTransfer_Unknown,"RemoteTransfer_Unknown" },
-	{ SCRSDK::CrError_RemoteTransfer_VideoFileNotSupported,"RemoteTransfer_VideoFileNotSupported" },
-	{ SCRSDK::CrError_RemoteTransfer_ContentNotFound,"RemoteTransfer_ContentNotFound" },
-	{ SCRSDK::CrError_RemoteTransfer_GetContentsDataDisable,"RemoteTransfer_GetContentsDataDisable" },
-	{ SCRSDK::CrError_RemoteTransfer_StatusError,"RemoteTransfer_StatusError" },
-	{ SCRSDK::CrError_RemoteTransfer_GetContentsInfoListProcessing,"RemoteTransfer_GetContentsInfoListProcessing" },
-	{ SCRSDK::CrError_Monitoring_Unknown,"Monitoring_Unknown" },
-	{ SCRSDK::CrError_Monitoring_InvalidCalled_AlreadyStart,"Monitoring_InvalidCalled_AlreadyStart" },
-	{ SCRSDK::CrError_Monitoring_InvalidCalled_AlreadyStop,"Monitoring_InvalidCalled_AlreadyStop" },
-	{ SCRSDK::CrError_Monitoring_InvalidCalled_LiveViewEnabled,"Monitoring_InvalidCalled_LiveViewEnabled" },
-	{ SCRSDK::CrError_Monitoring_InvalidCalled_PlaybackEnabled,"Monitoring_InvalidCalled_PlaybackEnabled" },
-	{ SCRSDK::CrError_Playback_Unknown,"Playback_Unknown" },
-	{ SCRSDK::CrError_Playback_InvalidCalled_LiveViewEnabled,"Playback_InvalidCalled_LiveViewEnabled" },
-	{ SCRSDK::CrError_Playback_InvalidCalled_MonitoringEnabled,"Playback_InvalidCalled_MonitoringEnabled" },
-	{ SCRSDK::CrWarning_Unknown,"Unknown" },
-	{ SCRSDK::CrWarning_Connect_Reconnected,"Connect_Reconnected" },
-	{ SCRSDK::CrWarning_Connect_Reconnecting,"Connect_Reconnecting" },
-	{ SCRSDK::CrWarning_File_StorageFull,"File_StorageFull" },
-	{ SCRSDK::CrWarning_SetFileName_Failed,"SetFileName_Failed" },
-	{ SCRSDK::CrWarning_GetImage_Failed,"GetImage_Failed" },
-	{ SCRSDK::CrWarning_FailedToSetCWB,"FailedToSetCWB" },
-	{ SCRSDK::CrWarning_NetworkErrorOccurred,"NetworkErrorOccurred" },
-	{ SCRSDK::CrWarning_NetworkErrorRecovered,"NetworkErrorRecovered" },
-	{ SCRSDK::CrWarning_Format_Failed,"Format_Failed" },
-	{ SCRSDK::CrWarning_Format_Invalid,"Format_Invalid" },
-	{ SCRSDK::CrWarning_Format_Complete,"Format_Complete" },
+//	{ SCRSDK::CrDeviceProperty_\1,"\1" },
+	{ SCRSDK::CrDeviceProperty_AEL,"AEL" },
+	{ SCRSDK::CrDeviceProperty_AFAreaPositionAF_C,"AFAreaPositionAF_C" },
+	{ SCRSDK::CrDeviceProperty_AFAreaPositionAF_S,"AFAreaPositionAF_S" },
+	{ SCRSDK::CrDeviceProperty_AFAssist,"AFAssist" },
+	{ SCRSDK::CrDeviceProperty_AFFreeSizeAndPositionSetting,"AFFreeSizeAndPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_AFIlluminator,"AFIlluminator" },
+	{ SCRSDK::CrDeviceProperty_AFInFocusMagnifier,"AFInFocusMagnifier" },
+	{ SCRSDK::CrDeviceProperty_AFSubjShiftSens,"AFSubjShiftSens" },
+	{ SCRSDK::CrDeviceProperty_AFTrackForSpeedChange,"AFTrackForSpeedChange" },
+	{ SCRSDK::CrDeviceProperty_AFTrackingSensitivity,"AFTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_AFTransitionSpeed,"AFTransitionSpeed" },
+	{ SCRSDK::CrDeviceProperty_AFWithShutter,"AFWithShutter" },
+	{ SCRSDK::CrDeviceProperty_AF_Area_Position,"AF_Area_Position" },
+	{ SCRSDK::CrDeviceProperty_APS_C_S35,"APS_C_S35" },
+	{ SCRSDK::CrDeviceProperty_APS_C_or_Full_SwitchingEnableStatus,"APS_C_or_Full_SwitchingEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_APS_C_or_Full_SwitchingSetting,"APS_C_or_Full_SwitchingSetting" },
+	{ SCRSDK::CrDeviceProperty_AWB,"AWB" },
+	{ SCRSDK::CrDeviceProperty_AWBL,"AWBL" },
+	{ SCRSDK::CrDeviceProperty_AmountOfDefocusSetting,"AmountOfDefocusSetting" },
+	{ SCRSDK::CrDeviceProperty_AntidustShutterWhenPowerOff,"AntidustShutterWhenPowerOff" },
+	{ SCRSDK::CrDeviceProperty_ApertureDriveInAF,"ApertureDriveInAF" },
+	{ SCRSDK::CrDeviceProperty_AreaTimeZoneSettingVersion,"AreaTimeZoneSettingVersion" },
+	{ SCRSDK::CrDeviceProperty_AspectRatio,"AspectRatio" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton1,"AssignableButton1" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton10,"AssignableButton10" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton11,"AssignableButton11" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton2,"AssignableButton2" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton3,"AssignableButton3" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton4,"AssignableButton4" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton5,"AssignableButton5" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton6,"AssignableButton6" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton7,"AssignableButton7" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton8,"AssignableButton8" },
+	{ SCRSDK::CrDeviceProperty_AssignableButton9,"AssignableButton9" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator1,"AssignableButtonIndicator1" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator10,"AssignableButtonIndicator10" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator11,"AssignableButtonIndicator11" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator2,"AssignableButtonIndicator2" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator3,"AssignableButtonIndicator3" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator4,"AssignableButtonIndicator4" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator5,"AssignableButtonIndicator5" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator6,"AssignableButtonIndicator6" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator7,"AssignableButtonIndicator7" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator8,"AssignableButtonIndicator8" },
+	{ SCRSDK::CrDeviceProperty_AssignableButtonIndicator9,"AssignableButtonIndicator9" },
+	{ SCRSDK::CrDeviceProperty_AudioInput1TypeSelect,"AudioInput1TypeSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInput2TypeSelect,"AudioInput2TypeSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH1InputSelect,"AudioInputCH1InputSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH1Level,"AudioInputCH1Level" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH1LevelControl,"AudioInputCH1LevelControl" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH1WindFilter,"AudioInputCH1WindFilter" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH2InputSelect,"AudioInputCH2InputSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH2Level,"AudioInputCH2Level" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH2LevelControl,"AudioInputCH2LevelControl" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH2WindFilter,"AudioInputCH2WindFilter" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH3InputSelect,"AudioInputCH3InputSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH3Level,"AudioInputCH3Level" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH3LevelControl,"AudioInputCH3LevelControl" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH3WindFilter,"AudioInputCH3WindFilter" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH4InputSelect,"AudioInputCH4InputSelect" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH4Level,"AudioInputCH4Level" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH4LevelControl,"AudioInputCH4LevelControl" },
+	{ SCRSDK::CrDeviceProperty_AudioInputCH4WindFilter,"AudioInputCH4WindFilter" },
+	{ SCRSDK::CrDeviceProperty_AudioInputMasterLevel,"AudioInputMasterLevel" },
+	{ SCRSDK::CrDeviceProperty_AudioLevelDisplay,"AudioLevelDisplay" },
+	{ SCRSDK::CrDeviceProperty_AudioRecording,"AudioRecording" },
+	{ SCRSDK::CrDeviceProperty_AudioSignals,"AudioSignals" },
+	{ SCRSDK::CrDeviceProperty_AudioSignalsStartEnd,"AudioSignalsStartEnd" },
+	{ SCRSDK::CrDeviceProperty_AudioSignalsVolume,"AudioSignalsVolume" },
+	{ SCRSDK::CrDeviceProperty_AudioStreamBitDepth,"AudioStreamBitDepth" },
+	{ SCRSDK::CrDeviceProperty_AudioStreamChannel,"AudioStreamChannel" },
+	{ SCRSDK::CrDeviceProperty_AudioStreamCodecType,"AudioStreamCodecType" },
+	{ SCRSDK::CrDeviceProperty_AudioStreamSamplingFrequency,"AudioStreamSamplingFrequency" },
+	{ SCRSDK::CrDeviceProperty_AutoFocusHold,"AutoFocusHold" },
+	{ SCRSDK::CrDeviceProperty_AutoPowerOffTemperature,"AutoPowerOffTemperature" },
+	{ SCRSDK::CrDeviceProperty_AutoRecognitionTargetCandidates,"AutoRecognitionTargetCandidates" },
+	{ SCRSDK::CrDeviceProperty_AutoRecognitionTargetSetting,"AutoRecognitionTargetSetting" },
+	{ SCRSDK::CrDeviceProperty_AutoReview,"AutoReview" },
+	{ SCRSDK::CrDeviceProperty_AutoSlowShutter,"AutoSlowShutter" },
+	{ SCRSDK::CrDeviceProperty_AutoSwitchMedia,"AutoSwitchMedia" },
+	{ SCRSDK::CrDeviceProperty_BaseISOSwitchEI,"BaseISOSwitchEI" },
+	{ SCRSDK::CrDeviceProperty_BaseLookAppliedofPlayback,"BaseLookAppliedofPlayback" },
+	{ SCRSDK::CrDeviceProperty_BaseLookImportOperationEnableStatus,"BaseLookImportOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_BaseLookNameofPlayback,"BaseLookNameofPlayback" },
+	{ SCRSDK::CrDeviceProperty_BaseLookValue,"BaseLookValue" },
+	{ SCRSDK::CrDeviceProperty_BatteryLevel,"BatteryLevel" },
+	{ SCRSDK::CrDeviceProperty_BatteryRemain,"BatteryRemain" },
+	{ SCRSDK::CrDeviceProperty_BatteryRemainDisplayUnit,"BatteryRemainDisplayUnit" },
+	{ SCRSDK::CrDeviceProperty_BatteryRemainingInMinutes,"BatteryRemainingInMinutes" },
+	{ SCRSDK::CrDeviceProperty_BatteryRemainingInVoltage,"BatteryRemainingInVoltage" },
+	{ SCRSDK::CrDeviceProperty_BodyKeyLock,"BodyKeyLock" },
+	{ SCRSDK::CrDeviceProperty_BodySerialNumber,"BodySerialNumber" },
+	{ SCRSDK::CrDeviceProperty_BracketOrder,"BracketOrder" },
+	{ SCRSDK::CrDeviceProperty_BulbExposureTimeSetting,"BulbExposureTimeSetting" },
+	{ SCRSDK::CrDeviceProperty_BulbTimerSetting,"BulbTimerSetting" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable1,"ButtonAssignmentAssignable1" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable10,"ButtonAssignmentAssignable10" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable11,"ButtonAssignmentAssignable11" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable2,"ButtonAssignmentAssignable2" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable3,"ButtonAssignmentAssignable3" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable4,"ButtonAssignmentAssignable4" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable5,"ButtonAssignmentAssignable5" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable6,"ButtonAssignmentAssignable6" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable7,"ButtonAssignmentAssignable7" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable8,"ButtonAssignmentAssignable8" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentAssignable9,"ButtonAssignmentAssignable9" },
+	{ SCRSDK::CrDeviceProperty_ButtonAssignmentLensAssignable1,"ButtonAssignmentLensAssignable1" },
+	{ SCRSDK::CrDeviceProperty_CallSetting,"CallSetting" },
+	{ SCRSDK::CrDeviceProperty_CameraButtonFunction,"CameraButtonFunction" },
+	{ SCRSDK::CrDeviceProperty_CameraButtonFunctionMulti,"CameraButtonFunctionMulti" },
+	{ SCRSDK::CrDeviceProperty_CameraButtonFunctionStatus,"CameraButtonFunctionStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraDialFunction,"CameraDialFunction" },
+	{ SCRSDK::CrDeviceProperty_CameraEframing,"CameraEframing" },
+	{ SCRSDK::CrDeviceProperty_CameraErrorCautionStatus,"CameraErrorCautionStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraLeverFunction,"CameraLeverFunction" },
+	{ SCRSDK::CrDeviceProperty_CameraOperatingMode,"CameraOperatingMode" },
+	{ SCRSDK::CrDeviceProperty_CameraPowerStatus,"CameraPowerStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraSetting_ReadOperationEnableStatus,"CameraSetting_ReadOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraSetting_SaveOperationEnableStatus,"CameraSetting_SaveOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraSetting_SaveRead_State,"CameraSetting_SaveRead_State" },
+	{ SCRSDK::CrDeviceProperty_CameraSettingsResetEnableStatus,"CameraSettingsResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraShakeStatus,"CameraShakeStatus" },
+	{ SCRSDK::CrDeviceProperty_CameraSystemErrorInfo,"CameraSystemErrorInfo" },
+	{ SCRSDK::CrDeviceProperty_CancelRemoteTouchOperationEnableStatus,"CancelRemoteTouchOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_Cancel_Media_FormatEnableStatus,"Cancel_Media_FormatEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CinematicVlogAFTransitionSpeed,"CinematicVlogAFTransitionSpeed" },
+	{ SCRSDK::CrDeviceProperty_CinematicVlogLook,"CinematicVlogLook" },
+	{ SCRSDK::CrDeviceProperty_CinematicVlogMood,"CinematicVlogMood" },
+	{ SCRSDK::CrDeviceProperty_CinematicVlogSetting,"CinematicVlogSetting" },
+	{ SCRSDK::CrDeviceProperty_ColorSpace,"ColorSpace" },
+	{ SCRSDK::CrDeviceProperty_ColorTuningAB,"ColorTuningAB" },
+	{ SCRSDK::CrDeviceProperty_ColorTuningGM,"ColorTuningGM" },
+	{ SCRSDK::CrDeviceProperty_Colortemp,"Colortemp" },
+	{ SCRSDK::CrDeviceProperty_ColortempStep,"ColortempStep" },
+	{ SCRSDK::CrDeviceProperty_CompressionFileFormatStill,"CompressionFileFormatStill" },
+	{ SCRSDK::CrDeviceProperty_ContentsTransferCancelEnableStatus,"ContentsTransferCancelEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_ContentsTransferProgress,"ContentsTransferProgress" },
+	{ SCRSDK::CrDeviceProperty_ContentsTransferStatus,"ContentsTransferStatus" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpeedInElectricShutterHi,"ContinuousShootingSpeedInElectricShutterHi" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpeedInElectricShutterHiPlus,"ContinuousShootingSpeedInElectricShutterHiPlus" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpeedInElectricShutterLo,"ContinuousShootingSpeedInElectricShutterLo" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpeedInElectricShutterMid,"ContinuousShootingSpeedInElectricShutterMid" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpotBoostEnableStatus,"ContinuousShootingSpotBoostEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpotBoostFrameSpeed,"ContinuousShootingSpotBoostFrameSpeed" },
+	{ SCRSDK::CrDeviceProperty_ContinuousShootingSpotBoostStatus,"ContinuousShootingSpotBoostStatus" },
+	{ SCRSDK::CrDeviceProperty_ControlForHDMI,"ControlForHDMI" },
+	{ SCRSDK::CrDeviceProperty_CreateNewFolder,"CreateNewFolder" },
+	{ SCRSDK::CrDeviceProperty_CreateNewFolderEnableStatus,"CreateNewFolderEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook,"CreativeLook" },
+	{ SCRSDK::CrDeviceProperty_CreativeLookResetEnableStatus,"CreativeLookResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Clarity,"CreativeLook_Clarity" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Contrast,"CreativeLook_Contrast" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_CustomLook,"CreativeLook_CustomLook" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Fade,"CreativeLook_Fade" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Highlights,"CreativeLook_Highlights" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Saturation,"CreativeLook_Saturation" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Shadows,"CreativeLook_Shadows" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_Sharpness,"CreativeLook_Sharpness" },
+	{ SCRSDK::CrDeviceProperty_CreativeLook_SharpnessRange,"CreativeLook_SharpnessRange" },
+	{ SCRSDK::CrDeviceProperty_CurrentSceneFileEdited,"CurrentSceneFileEdited" },
+	{ SCRSDK::CrDeviceProperty_CustomGridLineFileCommandVersion,"CustomGridLineFileCommandVersion" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capturable_Area,"CustomWB_Capturable_Area" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capture,"CustomWB_Capture" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capture_Frame_Size,"CustomWB_Capture_Frame_Size" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capture_Operation,"CustomWB_Capture_Operation" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capture_Standby,"CustomWB_Capture_Standby" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Capture_Standby_Cancel,"CustomWB_Capture_Standby_Cancel" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Execution_State,"CustomWB_Execution_State" },
+	{ SCRSDK::CrDeviceProperty_CustomWB_Size_Setting,"CustomWB_Size_Setting" },
+	{ SCRSDK::CrDeviceProperty_DCVoltage,"DCVoltage" },
+	{ SCRSDK::CrDeviceProperty_DRO,"DRO" },
+	{ SCRSDK::CrDeviceProperty_DateTime_Settings,"DateTime_Settings" },
+	{ SCRSDK::CrDeviceProperty_DeSqueezeDisplayRatio,"DeSqueezeDisplayRatio" },
+	{ SCRSDK::CrDeviceProperty_DebugMode,"DebugMode" },
+	{ SCRSDK::CrDeviceProperty_DefaultAFFreeSizeAndPositionSetting,"DefaultAFFreeSizeAndPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_DeleteContentOperationEnableStatusSLOT1,"DeleteContentOperationEnableStatusSLOT1" },
+	{ SCRSDK::CrDeviceProperty_DeleteContentOperationEnableStatusSLOT2,"DeleteContentOperationEnableStatusSLOT2" },
+	{ SCRSDK::CrDeviceProperty_DeleteUserBaseLook,"DeleteUserBaseLook" },
+	{ SCRSDK::CrDeviceProperty_DepthOfFieldAdjustmentInterlockingMode,"DepthOfFieldAdjustmentInterlockingMode" },
+	{ SCRSDK::CrDeviceProperty_DepthOfFieldAdjustmentMode,"DepthOfFieldAdjustmentMode" },
+	{ SCRSDK::CrDeviceProperty_DeviceOverheatingState,"DeviceOverheatingState" },
+	{ SCRSDK::CrDeviceProperty_DifferentSetForSQMovie,"DifferentSetForSQMovie" },
+	{ SCRSDK::CrDeviceProperty_DigitalExtenderMagnificationSetting,"DigitalExtenderMagnificationSetting" },
+	{ SCRSDK::CrDeviceProperty_DigitalZoomScale,"DigitalZoomScale" },
+	{ SCRSDK::CrDeviceProperty_DispMode,"DispMode" },
+	{ SCRSDK::CrDeviceProperty_DispModeCandidate,"DispModeCandidate" },
+	{ SCRSDK::CrDeviceProperty_DispModeSetting,"DispModeSetting" },
+	{ SCRSDK::CrDeviceProperty_DisplayQualityFinder,"DisplayQualityFinder" },
+	{ SCRSDK::CrDeviceProperty_DisplayedMenuStatus,"DisplayedMenuStatus" },
+	{ SCRSDK::CrDeviceProperty_DriveMode,"DriveMode" },
+	{ SCRSDK::CrDeviceProperty_EframingAutoFraming,"EframingAutoFraming" },
+	{ SCRSDK::CrDeviceProperty_EframingCommandVersion,"EframingCommandVersion" },
+	{ SCRSDK::CrDeviceProperty_EframingHDMICrop,"EframingHDMICrop" },
+	{ SCRSDK::CrDeviceProperty_EframingModeAuto,"EframingModeAuto" },
+	{ SCRSDK::CrDeviceProperty_EframingProductionEffect,"EframingProductionEffect" },
+	{ SCRSDK::CrDeviceProperty_EframingRecordingImageCrop,"EframingRecordingImageCrop" },
+	{ SCRSDK::CrDeviceProperty_EframingScaleAuto,"EframingScaleAuto" },
+	{ SCRSDK::CrDeviceProperty_EframingSpeedAuto,"EframingSpeedAuto" },
+	{ SCRSDK::CrDeviceProperty_EframingSpeedPTZ,"EframingSpeedPTZ" },
+	{ SCRSDK::CrDeviceProperty_EframingTrackingStartMode,"EframingTrackingStartMode" },
+	{ SCRSDK::CrDeviceProperty_EframingType,"EframingType" },
+	{ SCRSDK::CrDeviceProperty_ElectricFrontCurtainShutter,"ElectricFrontCurtainShutter" },
+	{ SCRSDK::CrDeviceProperty_EmbedLUTFile,"EmbedLUTFile" },
+	{ SCRSDK::CrDeviceProperty_EnlargeScreenSetting,"EnlargeScreenSetting" },
+	{ SCRSDK::CrDeviceProperty_EstimatePictureSize,"EstimatePictureSize" },
+	{ SCRSDK::CrDeviceProperty_ExposureBiasCompensation,"ExposureBiasCompensation" },
+	{ SCRSDK::CrDeviceProperty_ExposureCtrlType,"ExposureCtrlType" },
+	{ SCRSDK::CrDeviceProperty_ExposureIndex,"ExposureIndex" },
+	{ SCRSDK::CrDeviceProperty_ExposureProgramMode,"ExposureProgramMode" },
+	{ SCRSDK::CrDeviceProperty_ExposureStep,"ExposureStep" },
+	{ SCRSDK::CrDeviceProperty_ExtendedInterfaceMode,"ExtendedInterfaceMode" },
+	{ SCRSDK::CrDeviceProperty_ExtendedShutterSpeed,"ExtendedShutterSpeed" },
+	{ SCRSDK::CrDeviceProperty_FEL,"FEL" },
+	{ SCRSDK::CrDeviceProperty_FNumber,"FNumber" },
+	{ SCRSDK::CrDeviceProperty_FTPJobListDataVersion,"FTPJobListDataVersion" },
+	{ SCRSDK::CrDeviceProperty_FTPServerSettingOperationEnableStatus,"FTPServerSettingOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FTPServerSettingVersion,"FTPServerSettingVersion" },
+	{ SCRSDK::CrDeviceProperty_FTPTransferSetting_ReadOperationEnableStatus,"FTPTransferSetting_ReadOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FTPTransferSetting_SaveOperationEnableStatus,"FTPTransferSetting_SaveOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FTPTransferSetting_SaveRead_State,"FTPTransferSetting_SaveRead_State" },
+	{ SCRSDK::CrDeviceProperty_FTP_AutoTransfer,"FTP_AutoTransfer" },
+	{ SCRSDK::CrDeviceProperty_FTP_AutoTransferTarget,"FTP_AutoTransferTarget" },
+	{ SCRSDK::CrDeviceProperty_FTP_AutoTransferTarget_StillImage,"FTP_AutoTransferTarget_StillImage" },
+	{ SCRSDK::CrDeviceProperty_FTP_ConnectionErrorInfo,"FTP_ConnectionErrorInfo" },
+	{ SCRSDK::CrDeviceProperty_FTP_ConnectionStatus,"FTP_ConnectionStatus" },
+	{ SCRSDK::CrDeviceProperty_FTP_Function,"FTP_Function" },
+	{ SCRSDK::CrDeviceProperty_FTP_PowerSave,"FTP_PowerSave" },
+	{ SCRSDK::CrDeviceProperty_FTP_TransferStillImageQualitySize,"FTP_TransferStillImageQualitySize" },
+	{ SCRSDK::CrDeviceProperty_FTP_TransferTarget,"FTP_TransferTarget" },
+	{ SCRSDK::CrDeviceProperty_FaceEyeDetectionAFStatus,"FaceEyeDetectionAFStatus" },
+	{ SCRSDK::CrDeviceProperty_FaceEyeFrameDisplay,"FaceEyeFrameDisplay" },
+	{ SCRSDK::CrDeviceProperty_FacePriorityInMultiMetering,"FacePriorityInMultiMetering" },
+	{ SCRSDK::CrDeviceProperty_FileSettingsCameraId,"FileSettingsCameraId" },
+	{ SCRSDK::CrDeviceProperty_FileSettingsCameraPosition,"FileSettingsCameraPosition" },
+	{ SCRSDK::CrDeviceProperty_FileSettingsReelNumber,"FileSettingsReelNumber" },
+	{ SCRSDK::CrDeviceProperty_FileSettingsTitleNameSettings,"FileSettingsTitleNameSettings" },
+	{ SCRSDK::CrDeviceProperty_FileType,"FileType" },
+	{ SCRSDK::CrDeviceProperty_FirmwareUpdateCommandVersion,"FirmwareUpdateCommandVersion" },
+	{ SCRSDK::CrDeviceProperty_FlashCompensation,"FlashCompensation" },
+	{ SCRSDK::CrDeviceProperty_FlashMode,"FlashMode" },
+	{ SCRSDK::CrDeviceProperty_FlickerLessShooting,"FlickerLessShooting" },
+	{ SCRSDK::CrDeviceProperty_FlickerLessShootingStatus,"FlickerLessShootingStatus" },
+	{ SCRSDK::CrDeviceProperty_FlickerScanEnableStatus,"FlickerScanEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FlickerScanStatus,"FlickerScanStatus" },
+	{ SCRSDK::CrDeviceProperty_FocalDistanceInFeet,"FocalDistanceInFeet" },
+	{ SCRSDK::CrDeviceProperty_FocalDistanceInMeter,"FocalDistanceInMeter" },
+	{ SCRSDK::CrDeviceProperty_FocalDistanceUnitSetting,"FocalDistanceUnitSetting" },
+	{ SCRSDK::CrDeviceProperty_FocusArea,"FocusArea" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketExposureLock1stImg,"FocusBracketExposureLock1stImg" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketFocusRange,"FocusBracketFocusRange" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketIntervalUntilNextShot,"FocusBracketIntervalUntilNextShot" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketOrder,"FocusBracketOrder" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketRecordingFolder,"FocusBracketRecordingFolder" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketShootingStatus,"FocusBracketShootingStatus" },
+	{ SCRSDK::CrDeviceProperty_FocusBracketShotNumber,"FocusBracketShotNumber" },
+	{ SCRSDK::CrDeviceProperty_FocusDrivingStatus,"FocusDrivingStatus" },
+	{ SCRSDK::CrDeviceProperty_FocusIndication,"FocusIndication" },
+	{ SCRSDK::CrDeviceProperty_FocusMagnificationTime,"FocusMagnificationTime" },
+	{ SCRSDK::CrDeviceProperty_FocusMap,"FocusMap" },
+	{ SCRSDK::CrDeviceProperty_FocusMode,"FocusMode" },
+	{ SCRSDK::CrDeviceProperty_FocusModeSetting,"FocusModeSetting" },
+	{ SCRSDK::CrDeviceProperty_FocusModeStatus,"FocusModeStatus" },
+	{ SCRSDK::CrDeviceProperty_FocusOperationWithInt16,"FocusOperationWithInt16" },
+	{ SCRSDK::CrDeviceProperty_FocusOperationWithInt16EnableStatus,"FocusOperationWithInt16EnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FocusPositionCurrentValue,"FocusPositionCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_FocusPositionSetting,"FocusPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_FocusSpeedDirectSync,"FocusSpeedDirectSync" },
+	{ SCRSDK::CrDeviceProperty_FocusTouchSpotStatus,"FocusTouchSpotStatus" },
+	{ SCRSDK::CrDeviceProperty_FocusTrackingStatus,"FocusTrackingStatus" },
+	{ SCRSDK::CrDeviceProperty_Focus_Magnifier_Setting,"Focus_Magnifier_Setting" },
+	{ SCRSDK::CrDeviceProperty_Focus_Operation,"Focus_Operation" },
+	{ SCRSDK::CrDeviceProperty_Focus_Speed_Range,"Focus_Speed_Range" },
+	{ SCRSDK::CrDeviceProperty_FollowFocusPositionCurrentValue,"FollowFocusPositionCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_FollowFocusPositionSetting,"FollowFocusPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_ForcedFileNumberResetEnableStatus,"ForcedFileNumberResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_FullTimeDMF,"FullTimeDMF" },
+	{ SCRSDK::CrDeviceProperty_FunctionOfRemoteTouchOperation,"FunctionOfRemoteTouchOperation" },
+	{ SCRSDK::CrDeviceProperty_FunctionOfTouchOperation,"FunctionOfTouchOperation" },
+	{ SCRSDK::CrDeviceProperty_GainBaseIsoSensitivity,"GainBaseIsoSensitivity" },
+	{ SCRSDK::CrDeviceProperty_GainBaseSensitivity,"GainBaseSensitivity" },
+	{ SCRSDK::CrDeviceProperty_GainControlSetting,"GainControlSetting" },
+	{ SCRSDK::CrDeviceProperty_GainUnitSetting,"GainUnitSetting" },
+	{ SCRSDK::CrDeviceProperty_GaindBCurrentValue,"GaindBCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_GaindBValue,"GaindBValue" },
+	{ SCRSDK::CrDeviceProperty_GammaDisplayAssist,"GammaDisplayAssist" },
+	{ SCRSDK::CrDeviceProperty_GammaDisplayAssistType,"GammaDisplayAssistType" },
+	{ SCRSDK::CrDeviceProperty_GridLineDisplay,"GridLineDisplay" },
+	{ SCRSDK::CrDeviceProperty_GridLineDisplayPlayback,"GridLineDisplayPlayback" },
+	{ SCRSDK::CrDeviceProperty_GridLineType,"GridLineType" },
+	{ SCRSDK::CrDeviceProperty_HDMIResolutionStillPlay,"HDMIResolutionStillPlay" },
+	{ SCRSDK::CrDeviceProperty_HLGStillImage,"HLGStillImage" },
+	{ SCRSDK::CrDeviceProperty_HighIsoNR,"HighIsoNR" },
+	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeed,"HighResolutionShutterSpeed" },
+	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeedAdjust,"HighResolutionShutterSpeedAdjust" },
+	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeedAdjustInIntegralMultiples,"HighResolutionShutterSpeedAdjustInIntegralMultiples" },
+	{ SCRSDK::CrDeviceProperty_HighResolutionShutterSpeedSetting,"HighResolutionShutterSpeedSetting" },
+	{ SCRSDK::CrDeviceProperty_HomeMenuSetting,"HomeMenuSetting" },
+	{ SCRSDK::CrDeviceProperty_IPSetupProtocolSetting,"IPSetupProtocolSetting" },
+	{ SCRSDK::CrDeviceProperty_IRRemoteSetting,"IRRemoteSetting" },
+	{ SCRSDK::CrDeviceProperty_ImageID_Num,"ImageID_Num" },
+	{ SCRSDK::CrDeviceProperty_ImageID_Num_Setting,"ImageID_Num_Setting" },
+	{ SCRSDK::CrDeviceProperty_ImageID_String,"ImageID_String" },
+	{ SCRSDK::CrDeviceProperty_ImageSize,"ImageSize" },
+	{ SCRSDK::CrDeviceProperty_ImageStabilizationFramingStabilizer,"ImageStabilizationFramingStabilizer" },
+	{ SCRSDK::CrDeviceProperty_ImageStabilizationSteadyShot,"ImageStabilizationSteadyShot" },
+	{ SCRSDK::CrDeviceProperty_ImageStabilizationSteadyShotAdjust,"ImageStabilizationSteadyShotAdjust" },
+	{ SCRSDK::CrDeviceProperty_ImageStabilizationSteadyShotFocalLength,"ImageStabilizationSteadyShotFocalLength" },
+	{ SCRSDK::CrDeviceProperty_ImagerScanMode,"ImagerScanMode" },
+	{ SCRSDK::CrDeviceProperty_InitialFocusMagnifier,"InitialFocusMagnifier" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_AETrackingSensitivity,"IntervalRec_AETrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_NumberOfShots,"IntervalRec_NumberOfShots" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_ShootIntervalPriority,"IntervalRec_ShootIntervalPriority" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_ShootingInterval,"IntervalRec_ShootingInterval" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_ShootingStartTime,"IntervalRec_ShootingStartTime" },
+	{ SCRSDK::CrDeviceProperty_IntervalRec_ShutterType,"IntervalRec_ShutterType" },
+	{ SCRSDK::CrDeviceProperty_Interval_Rec_Mode,"Interval_Rec_Mode" },
+	{ SCRSDK::CrDeviceProperty_Interval_Rec_Status,"Interval_Rec_Status" },
+	{ SCRSDK::CrDeviceProperty_IrisCloseSetting,"IrisCloseSetting" },
+	{ SCRSDK::CrDeviceProperty_IrisDisplayUnit,"IrisDisplayUnit" },
+	{ SCRSDK::CrDeviceProperty_IrisModeSetting,"IrisModeSetting" },
+	{ SCRSDK::CrDeviceProperty_IsoAutoMinShutterSpeedManual,"IsoAutoMinShutterSpeedManual" },
+	{ SCRSDK::CrDeviceProperty_IsoAutoMinShutterSpeedMode,"IsoAutoMinShutterSpeedMode" },
+	{ SCRSDK::CrDeviceProperty_IsoAutoMinShutterSpeedPreset,"IsoAutoMinShutterSpeedPreset" },
+	{ SCRSDK::CrDeviceProperty_IsoAutoRangeLimitMax,"IsoAutoRangeLimitMax" },
+	{ SCRSDK::CrDeviceProperty_IsoAutoRangeLimitMin,"IsoAutoRangeLimitMin" },
+	{ SCRSDK::CrDeviceProperty_IsoCurrentSensitivity,"IsoCurrentSensitivity" },
+	{ SCRSDK::CrDeviceProperty_IsoSensitivity,"IsoSensitivity" },
+	{ SCRSDK::CrDeviceProperty_LanguageSetting,"LanguageSetting" },
+	{ SCRSDK::CrDeviceProperty_LensAssignableButton1,"LensAssignableButton1" },
+	{ SCRSDK::CrDeviceProperty_LensAssignableButtonIndicator1,"LensAssignableButtonIndicator1" },
+	{ SCRSDK::CrDeviceProperty_LensCompensationBreathing,"LensCompensationBreathing" },
+	{ SCRSDK::CrDeviceProperty_LensCompensationChromaticAberration,"LensCompensationChromaticAberration" },
+	{ SCRSDK::CrDeviceProperty_LensCompensationDistortion,"LensCompensationDistortion" },
+	{ SCRSDK::CrDeviceProperty_LensCompensationShading,"LensCompensationShading" },
+	{ SCRSDK::CrDeviceProperty_LensInformationEnableStatus,"LensInformationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_LensModelName,"LensModelName" },
+	{ SCRSDK::CrDeviceProperty_LensSerialNumber,"LensSerialNumber" },
+	{ SCRSDK::CrDeviceProperty_LensVersionNumber,"LensVersionNumber" },
+	{ SCRSDK::CrDeviceProperty_LiveViewDisplayEffect,"LiveViewDisplayEffect" },
+	{ SCRSDK::CrDeviceProperty_LiveViewImageQualityByNumericalValue,"LiveViewImageQualityByNumericalValue" },
+	{ SCRSDK::CrDeviceProperty_LiveViewProtocol,"LiveViewProtocol" },
+	{ SCRSDK::CrDeviceProperty_LiveViewStatus,"LiveViewStatus" },
+	{ SCRSDK::CrDeviceProperty_LiveView_Area,"LiveView_Area" },
+	{ SCRSDK::CrDeviceProperty_LiveView_Image_Quality,"LiveView_Image_Quality" },
+	{ SCRSDK::CrDeviceProperty_LogShootingMode,"LogShootingMode" },
+	{ SCRSDK::CrDeviceProperty_LogShootingModeColorGamut,"LogShootingModeColorGamut" },
+	{ SCRSDK::CrDeviceProperty_LongExposureNR,"LongExposureNR" },
+	{ SCRSDK::CrDeviceProperty_ManualInputForNDFilterValue,"ManualInputForNDFilterValue" },
+	{ SCRSDK::CrDeviceProperty_MaximumNumberOfBytes,"MaximumNumberOfBytes" },
+	{ SCRSDK::CrDeviceProperty_MaximumSizeOfImageIDString,"MaximumSizeOfImageIDString" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1Player,"MediaSLOT1Player" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_ContentsInfoListEnableStatus,"MediaSLOT1_ContentsInfoListEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_ContentsInfoListRegenerateUpdateTime,"MediaSLOT1_ContentsInfoListRegenerateUpdateTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_ContentsInfoListUpdateTime,"MediaSLOT1_ContentsInfoListUpdateTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_FileType,"MediaSLOT1_FileType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_FormatEnableStatus,"MediaSLOT1_FormatEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_ImageQuality,"MediaSLOT1_ImageQuality" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_ImageSize,"MediaSLOT1_ImageSize" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_QuickFormatEnableStatus,"MediaSLOT1_QuickFormatEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_RAW_FileCompressionType,"MediaSLOT1_RAW_FileCompressionType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_RecordingAvailableType,"MediaSLOT1_RecordingAvailableType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_RemainingNumber,"MediaSLOT1_RemainingNumber" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_RemainingTime,"MediaSLOT1_RemainingTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_Status,"MediaSLOT1_Status" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT1_WritingState,"MediaSLOT1_WritingState" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2Player,"MediaSLOT2Player" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_ContentsInfoListEnableStatus,"MediaSLOT2_ContentsInfoListEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_ContentsInfoListRegenerateUpdateTime,"MediaSLOT2_ContentsInfoListRegenerateUpdateTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_ContentsInfoListUpdateTime,"MediaSLOT2_ContentsInfoListUpdateTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_FileType,"MediaSLOT2_FileType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_FormatEnableStatus,"MediaSLOT2_FormatEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_ImageQuality,"MediaSLOT2_ImageQuality" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_ImageSize,"MediaSLOT2_ImageSize" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_QuickFormatEnableStatus,"MediaSLOT2_QuickFormatEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_RAW_FileCompressionType,"MediaSLOT2_RAW_FileCompressionType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_RecordingAvailableType,"MediaSLOT2_RecordingAvailableType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_RemainingNumber,"MediaSLOT2_RemainingNumber" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_RemainingTime,"MediaSLOT2_RemainingTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_Status,"MediaSLOT2_Status" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT2_WritingState,"MediaSLOT2_WritingState" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT3_RecordingAvailableType,"MediaSLOT3_RecordingAvailableType" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT3_RemainingTime,"MediaSLOT3_RemainingTime" },
+	{ SCRSDK::CrDeviceProperty_MediaSLOT3_Status,"MediaSLOT3_Status" },
+	{ SCRSDK::CrDeviceProperty_Media_FormatProgressRate,"Media_FormatProgressRate" },
+	{ SCRSDK::CrDeviceProperty_MeteredManualLevel,"MeteredManualLevel" },
+	{ SCRSDK::CrDeviceProperty_MeteringMode,"MeteringMode" },
+	{ SCRSDK::CrDeviceProperty_MicrophoneDirectivity,"MicrophoneDirectivity" },
+	{ SCRSDK::CrDeviceProperty_ModelName,"ModelName" },
+	{ SCRSDK::CrDeviceProperty_MonitorBrightnessManual,"MonitorBrightnessManual" },
+	{ SCRSDK::CrDeviceProperty_MonitorBrightnessType,"MonitorBrightnessType" },
+	{ SCRSDK::CrDeviceProperty_MonitorLUTSetting,"MonitorLUTSetting" },
+	{ SCRSDK::CrDeviceProperty_MonitorLUTSetting1,"MonitorLUTSetting1" },
+	{ SCRSDK::CrDeviceProperty_MonitorLUTSetting2,"MonitorLUTSetting2" },
+	{ SCRSDK::CrDeviceProperty_MonitorLUTSetting3,"MonitorLUTSetting3" },
+	{ SCRSDK::CrDeviceProperty_MonitorLUTSettingOutputDestAssign,"MonitorLUTSettingOutputDestAssign" },
+	{ SCRSDK::CrDeviceProperty_MonitoringAvailableFormat,"MonitoringAvailableFormat" },
+	{ SCRSDK::CrDeviceProperty_MonitoringDeliveringStatus,"MonitoringDeliveringStatus" },
+	{ SCRSDK::CrDeviceProperty_MonitoringDeliveryTypeSupportInfo,"MonitoringDeliveryTypeSupportInfo" },
+	{ SCRSDK::CrDeviceProperty_MonitoringFormatSupportInformation,"MonitoringFormatSupportInformation" },
+	{ SCRSDK::CrDeviceProperty_MonitoringIsDelivering,"MonitoringIsDelivering" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplayHDMI,"MonitoringOutputDisplayHDMI" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySDI,"MonitoringOutputDisplaySDI" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting1,"MonitoringOutputDisplaySetting1" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySetting2,"MonitoringOutputDisplaySetting2" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputDisplaySettingDestAssign,"MonitoringOutputDisplaySettingDestAssign" },
+	{ SCRSDK::CrDeviceProperty_MonitoringOutputFormat,"MonitoringOutputFormat" },
+	{ SCRSDK::CrDeviceProperty_MonitoringReserved,"MonitoringReserved" },
+	{ SCRSDK::CrDeviceProperty_MonitoringSettingVersion,"MonitoringSettingVersion" },
+	{ SCRSDK::CrDeviceProperty_MonitoringTransportProtocol,"MonitoringTransportProtocol" },
+	{ SCRSDK::CrDeviceProperty_MovieForwardButton,"MovieForwardButton" },
+	{ SCRSDK::CrDeviceProperty_MovieNextButton,"MovieNextButton" },
+	{ SCRSDK::CrDeviceProperty_MoviePlayButton,"MoviePlayButton" },
+	{ SCRSDK::CrDeviceProperty_MoviePlayPauseButton,"MoviePlayPauseButton" },
+	{ SCRSDK::CrDeviceProperty_MoviePlayStopButton,"MoviePlayStopButton" },
+	{ SCRSDK::CrDeviceProperty_MoviePlayingSpeed,"MoviePlayingSpeed" },
+	{ SCRSDK::CrDeviceProperty_MoviePlayingState,"MoviePlayingState" },
+	{ SCRSDK::CrDeviceProperty_MoviePrevButton,"MoviePrevButton" },
+	{ SCRSDK::CrDeviceProperty_MovieQualityFullAutoMode,"MovieQualityFullAutoMode" },
+	{ SCRSDK::CrDeviceProperty_MovieRecButtonToggleEnableStatus,"MovieRecButtonToggleEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_MovieRecReviewButton,"MovieRecReviewButton" },
+	{ SCRSDK::CrDeviceProperty_MovieRecReviewPlayingState,"MovieRecReviewPlayingState" },
+	{ SCRSDK::CrDeviceProperty_MovieRewindButton,"MovieRewindButton" },
+	{ SCRSDK::CrDeviceProperty_MovieShootingMode,"MovieShootingMode" },
+	{ SCRSDK::CrDeviceProperty_MovieShootingModeColorGamut,"MovieShootingModeColorGamut" },
+	{ SCRSDK::CrDeviceProperty_MovieShootingModeTargetDisplay,"MovieShootingModeTargetDisplay" },
+	{ SCRSDK::CrDeviceProperty_Movie_FTP_AutoTransferTarget,"Movie_FTP_AutoTransferTarget" },
+	{ SCRSDK::CrDeviceProperty_Movie_FTP_TransferTarget,"Movie_FTP_TransferTarget" },
+	{ SCRSDK::CrDeviceProperty_Movie_File_Format,"Movie_File_Format" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutput4KSetting,"Movie_HDMIOutput4KSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputAudioCH,"Movie_HDMIOutputAudioCH" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputColorGamutForRAWOut,"Movie_HDMIOutputColorGamutForRAWOut" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputRAW,"Movie_HDMIOutputRAW" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputRawSetting,"Movie_HDMIOutputRawSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputRecControl,"Movie_HDMIOutputRecControl" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputRecMedia,"Movie_HDMIOutputRecMedia" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputResolution,"Movie_HDMIOutputResolution" },
+	{ SCRSDK::CrDeviceProperty_Movie_HDMIOutputTimeCode,"Movie_HDMIOutputTimeCode" },
+	{ SCRSDK::CrDeviceProperty_Movie_ImageStabilizationLevel,"Movie_ImageStabilizationLevel" },
+	{ SCRSDK::CrDeviceProperty_Movie_ImageStabilizationSteadyShot,"Movie_ImageStabilizationSteadyShot" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRecFrames,"Movie_IntervalRecFrames" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRec_CountDownIntervalTime,"Movie_IntervalRec_CountDownIntervalTime" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRec_FrameRateSetting,"Movie_IntervalRec_FrameRateSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRec_IntervalTime,"Movie_IntervalRec_IntervalTime" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRec_RecordingDuration,"Movie_IntervalRec_RecordingDuration" },
+	{ SCRSDK::CrDeviceProperty_Movie_IntervalRec_RecordingSetting,"Movie_IntervalRec_RecordingSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_ProxyFileFormat,"Movie_ProxyFileFormat" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingFileNumber,"Movie_RecordingFileNumber" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingFrameRateRTSPSetting,"Movie_RecordingFrameRateRTSPSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingMedia,"Movie_RecordingMedia" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingResolutionForRAW,"Movie_RecordingResolutionForRAW" },
+	{ SCRSDK::CrDeviceProperty_Movie_RecordingResolutionForRTSP,"Movie_RecordingResolutionForRTSP" },
+	{ SCRSDK::CrDeviceProperty_Movie_Recording_FrameRateProxySetting,"Movie_Recording_FrameRateProxySetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_Recording_FrameRateSetting,"Movie_Recording_FrameRateSetting" },
+	{ SCRSDK::CrDeviceProperty_Movie_Recording_ResolutionForMain,"Movie_Recording_ResolutionForMain" },
+	{ SCRSDK::CrDeviceProperty_Movie_Recording_ResolutionForProxy,"Movie_Recording_ResolutionForProxy" },
+	{ SCRSDK::CrDeviceProperty_Movie_Recording_Setting,"Movie_Recording_Setting" },
+	{ SCRSDK::CrDeviceProperty_NDFilter,"NDFilter" },
+	{ SCRSDK::CrDeviceProperty_NDFilterMode,"NDFilterMode" },
+	{ SCRSDK::CrDeviceProperty_NDFilterModeSetting,"NDFilterModeSetting" },
+	{ SCRSDK::CrDeviceProperty_NDFilterOpticalDensityValue,"NDFilterOpticalDensityValue" },
+	{ SCRSDK::CrDeviceProperty_NDFilterPositionSetting,"NDFilterPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_NDFilterPreset1Value,"NDFilterPreset1Value" },
+	{ SCRSDK::CrDeviceProperty_NDFilterPreset2Value,"NDFilterPreset2Value" },
+	{ SCRSDK::CrDeviceProperty_NDFilterPreset3Value,"NDFilterPreset3Value" },
+	{ SCRSDK::CrDeviceProperty_NDFilterPresetSelect,"NDFilterPresetSelect" },
+	{ SCRSDK::CrDeviceProperty_NDFilterSwitchingSetting,"NDFilterSwitchingSetting" },
+	{ SCRSDK::CrDeviceProperty_NDFilterUnitSetting,"NDFilterUnitSetting" },
+	{ SCRSDK::CrDeviceProperty_NDFilterValue,"NDFilterValue" },
+	{ SCRSDK::CrDeviceProperty_NearFar,"NearFar" },
+	{ SCRSDK::CrDeviceProperty_OSDImageMode,"OSDImageMode" },
+	{ SCRSDK::CrDeviceProperty_PaintLookAutoKnee,"PaintLookAutoKnee" },
+	{ SCRSDK::CrDeviceProperty_PaintLookBBlack,"PaintLookBBlack" },
+	{ SCRSDK::CrDeviceProperty_PaintLookDetailLevel,"PaintLookDetailLevel" },
+	{ SCRSDK::CrDeviceProperty_PaintLookDetailSetting,"PaintLookDetailSetting" },
+	{ SCRSDK::CrDeviceProperty_PaintLookKneePoint,"PaintLookKneePoint" },
+	{ SCRSDK::CrDeviceProperty_PaintLookKneeSetting,"PaintLookKneeSetting" },
+	{ SCRSDK::CrDeviceProperty_PaintLookKneeSlope,"PaintLookKneeSlope" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMasterBlack,"PaintLookMasterBlack" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixAreaIndication,"PaintLookMultiMatrixAreaIndication" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixAxis,"PaintLookMultiMatrixAxis" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixHue,"PaintLookMultiMatrixHue" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixSaturation,"PaintLookMultiMatrixSaturation" },
+	{ SCRSDK::CrDeviceProperty_PaintLookMultiMatrixSetting,"PaintLookMultiMatrixSetting" },
+	{ SCRSDK::CrDeviceProperty_PaintLookRBlack,"PaintLookRBlack" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixBG,"PaintLookUserMatrixBG" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixBR,"PaintLookUserMatrixBR" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixGB,"PaintLookUserMatrixGB" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixGR,"PaintLookUserMatrixGR" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixLevel,"PaintLookUserMatrixLevel" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixPhase,"PaintLookUserMatrixPhase" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixRB,"PaintLookUserMatrixRB" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixRG,"PaintLookUserMatrixRG" },
+	{ SCRSDK::CrDeviceProperty_PaintLookUserMatrixSetting,"PaintLookUserMatrixSetting" },
+	{ SCRSDK::CrDeviceProperty_PanLimitMode,"PanLimitMode" },
+	{ SCRSDK::CrDeviceProperty_PanLimitRangeMaximum,"PanLimitRangeMaximum" },
+	{ SCRSDK::CrDeviceProperty_PanLimitRangeMinimum,"PanLimitRangeMinimum" },
+	{ SCRSDK::CrDeviceProperty_PanPositionCurrentValue,"PanPositionCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_PanPositionStatus,"PanPositionStatus" },
+	{ SCRSDK::CrDeviceProperty_PanTiltAccelerationRampCurve,"PanTiltAccelerationRampCurve" },
+	{ SCRSDK::CrDeviceProperty_PictureCacheRecSetting,"PictureCacheRecSetting" },
+	{ SCRSDK::CrDeviceProperty_PictureCacheRecSizeAndTime,"PictureCacheRecSizeAndTime" },
+	{ SCRSDK::CrDeviceProperty_PictureEffect,"PictureEffect" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile,"PictureProfile" },
+	{ SCRSDK::CrDeviceProperty_PictureProfileResetEnableStatus,"PictureProfileResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_BlackGammaLevel,"PictureProfile_BlackGammaLevel" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_BlackGammaRange,"PictureProfile_BlackGammaRange" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_BlackLevel,"PictureProfile_BlackLevel" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthBlue,"PictureProfile_ColorDepthBlue" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthCyan,"PictureProfile_ColorDepthCyan" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthGreen,"PictureProfile_ColorDepthGreen" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthMagenta,"PictureProfile_ColorDepthMagenta" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthRed,"PictureProfile_ColorDepthRed" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorDepthYellow,"PictureProfile_ColorDepthYellow" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorMode,"PictureProfile_ColorMode" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_ColorPhase,"PictureProfile_ColorPhase" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_Copy,"PictureProfile_Copy" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustBWBalance,"PictureProfile_DetailAdjustBWBalance" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustCrispening,"PictureProfile_DetailAdjustCrispening" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustHiLightDetail,"PictureProfile_DetailAdjustHiLightDetail" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustLimit,"PictureProfile_DetailAdjustLimit" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustMode,"PictureProfile_DetailAdjustMode" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailAdjustVHBalance,"PictureProfile_DetailAdjustVHBalance" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_DetailLevel,"PictureProfile_DetailLevel" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_Gamma,"PictureProfile_Gamma" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_KneeAutoSet_MaxPoint,"PictureProfile_KneeAutoSet_MaxPoint" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_KneeAutoSet_Sensitivity,"PictureProfile_KneeAutoSet_Sensitivity" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_KneeManualSet_Point,"PictureProfile_KneeManualSet_Point" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_KneeManualSet_Slope,"PictureProfile_KneeManualSet_Slope" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_KneeMode,"PictureProfile_KneeMode" },
+	{ SCRSDK::CrDeviceProperty_PictureProfile_Saturation,"PictureProfile_Saturation" },
+	{ SCRSDK::CrDeviceProperty_PixelMappingEnableStatus,"PixelMappingEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_PlaySetOfMultiMedia,"PlaySetOfMultiMedia" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsGammaType,"PlaybackContentsGammaType" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsName,"PlaybackContentsName" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsNumber,"PlaybackContentsNumber" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsRecordingDateTime,"PlaybackContentsRecordingDateTime" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsRecordingFileFormat,"PlaybackContentsRecordingFileFormat" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsRecordingFrameRate,"PlaybackContentsRecordingFrameRate" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsRecordingResolution,"PlaybackContentsRecordingResolution" },
+	{ SCRSDK::CrDeviceProperty_PlaybackContentsTotalNumber,"PlaybackContentsTotalNumber" },
+	{ SCRSDK::CrDeviceProperty_PlaybackMedia,"PlaybackMedia" },
+	{ SCRSDK::CrDeviceProperty_PlaybackViewMode,"PlaybackViewMode" },
+	{ SCRSDK::CrDeviceProperty_PlaybackVolumeSettings,"PlaybackVolumeSettings" },
+	{ SCRSDK::CrDeviceProperty_PostViewTransferResourceStatus,"PostViewTransferResourceStatus" },
+	{ SCRSDK::CrDeviceProperty_PowerSource,"PowerSource" },
+	{ SCRSDK::CrDeviceProperty_PreAF,"PreAF" },
+	{ SCRSDK::CrDeviceProperty_PresetPTZFSlotNumber,"PresetPTZFSlotNumber" },
+	{ SCRSDK::CrDeviceProperty_PriorityKeySettings,"PriorityKeySettings" },
+	{ SCRSDK::CrDeviceProperty_PrioritySetInAF_C,"PrioritySetInAF_C" },
+	{ SCRSDK::CrDeviceProperty_PrioritySetInAF_S,"PrioritySetInAF_S" },
+	{ SCRSDK::CrDeviceProperty_PrioritySetInAWB,"PrioritySetInAWB" },
+	{ SCRSDK::CrDeviceProperty_ProductShowcaseSet,"ProductShowcaseSet" },
+	{ SCRSDK::CrDeviceProperty_ProgramShiftStatus,"ProgramShiftStatus" },
+	{ SCRSDK::CrDeviceProperty_ProtectImageInFTPTransfer,"ProtectImageInFTPTransfer" },
+	{ SCRSDK::CrDeviceProperty_ProxyRecordingSetting,"ProxyRecordingSetting" },
+	{ SCRSDK::CrDeviceProperty_PushAFModeSetting,"PushAFModeSetting" },
+	{ SCRSDK::CrDeviceProperty_PushAGC,"PushAGC" },
+	{ SCRSDK::CrDeviceProperty_PushAutoFocus,"PushAutoFocus" },
+	{ SCRSDK::CrDeviceProperty_PushAutoIris,"PushAutoIris" },
+	{ SCRSDK::CrDeviceProperty_PushAutoNDFilter,"PushAutoNDFilter" },
+	{ SCRSDK::CrDeviceProperty_RAW_FileCompressionType,"RAW_FileCompressionType" },
+	{ SCRSDK::CrDeviceProperty_RAW_J_PC_Save_Image,"RAW_J_PC_Save_Image" },
+	{ SCRSDK::CrDeviceProperty_RecognitionTarget,"RecognitionTarget" },
+	{ SCRSDK::CrDeviceProperty_RecordablePowerSources,"RecordablePowerSources" },
+	{ SCRSDK::CrDeviceProperty_RecorderClipName,"RecorderClipName" },
+	{ SCRSDK::CrDeviceProperty_RecorderControlMainSetting,"RecorderControlMainSetting" },
+	{ SCRSDK::CrDeviceProperty_RecorderControlProxySetting,"RecorderControlProxySetting" },
+	{ SCRSDK::CrDeviceProperty_RecorderExtRawStatus,"RecorderExtRawStatus" },
+	{ SCRSDK::CrDeviceProperty_RecorderMainStatus,"RecorderMainStatus" },
+	{ SCRSDK::CrDeviceProperty_RecorderProxyStatus,"RecorderProxyStatus" },
+	{ SCRSDK::CrDeviceProperty_RecorderSaveDestination,"RecorderSaveDestination" },
+	{ SCRSDK::CrDeviceProperty_RecorderStartMain,"RecorderStartMain" },
+	{ SCRSDK::CrDeviceProperty_RecorderStartProxy,"RecorderStartProxy" },
+	{ SCRSDK::CrDeviceProperty_RecordingFileNumber,"RecordingFileNumber" },
+	{ SCRSDK::CrDeviceProperty_RecordingFolderFormat,"RecordingFolderFormat" },
+	{ SCRSDK::CrDeviceProperty_RecordingMedia,"RecordingMedia" },
+	{ SCRSDK::CrDeviceProperty_RecordingSelfTimer,"RecordingSelfTimer" },
+	{ SCRSDK::CrDeviceProperty_RecordingSelfTimerContinuous,"RecordingSelfTimerContinuous" },
+	{ SCRSDK::CrDeviceProperty_RecordingSelfTimerCountTime,"RecordingSelfTimerCountTime" },
+	{ SCRSDK::CrDeviceProperty_RecordingSelfTimerStatus,"RecordingSelfTimerStatus" },
+	{ SCRSDK::CrDeviceProperty_RecordingSettingFileName,"RecordingSettingFileName" },
+	{ SCRSDK::CrDeviceProperty_RecordingState,"RecordingState" },
+	{ SCRSDK::CrDeviceProperty_RedEyeReduction,"RedEyeReduction" },
+	{ SCRSDK::CrDeviceProperty_ReleaseWithoutCard,"ReleaseWithoutCard" },
+	{ SCRSDK::CrDeviceProperty_ReleaseWithoutLens,"ReleaseWithoutLens" },
+	{ SCRSDK::CrDeviceProperty_Remocon_Zoom_Speed_Type,"Remocon_Zoom_Speed_Type" },
+	{ SCRSDK::CrDeviceProperty_RemoteKeySLOTSelectButton,"RemoteKeySLOTSelectButton" },
+	{ SCRSDK::CrDeviceProperty_RemoteKeyThumbnailButton,"RemoteKeyThumbnailButton" },
+	{ SCRSDK::CrDeviceProperty_RemoteSaveImageSize,"RemoteSaveImageSize" },
+	{ SCRSDK::CrDeviceProperty_RemoteTouchOperation,"RemoteTouchOperation" },
+	{ SCRSDK::CrDeviceProperty_RemoteTouchOperationEnableStatus,"RemoteTouchOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_Reserved1,"Reserved1" },
+	{ SCRSDK::CrDeviceProperty_RightLeftEyeSelect,"RightLeftEyeSelect" },
+	{ SCRSDK::CrDeviceProperty_S1,"S1" },
+	{ SCRSDK::CrDeviceProperty_S2,"S2" },
+	{ SCRSDK::CrDeviceProperty_SQFrameRate,"SQFrameRate" },
+	{ SCRSDK::CrDeviceProperty_SQModeSetting,"SQModeSetting" },
+	{ SCRSDK::CrDeviceProperty_SQRecordingFrameRateSetting,"SQRecordingFrameRateSetting" },
+	{ SCRSDK::CrDeviceProperty_SQRecordingSetting,"SQRecordingSetting" },
+	{ SCRSDK::CrDeviceProperty_SceneFileCommandVersion,"SceneFileCommandVersion" },
+	{ SCRSDK::CrDeviceProperty_SceneFileDownloadOperationEnableStatus,"SceneFileDownloadOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_SceneFileIndex,"SceneFileIndex" },
+	{ SCRSDK::CrDeviceProperty_SceneFileIndexesAvailableForDownload,"SceneFileIndexesAvailableForDownload" },
+	{ SCRSDK::CrDeviceProperty_SceneFileUploadOperationEnableStatus,"SceneFileUploadOperationEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_SdkControlMode,"SdkControlMode" },
+	{ SCRSDK::CrDeviceProperty_SecondBatteryLevel,"SecondBatteryLevel" },
+	{ SCRSDK::CrDeviceProperty_SecondBatteryRemain,"SecondBatteryRemain" },
+	{ SCRSDK::CrDeviceProperty_SelectFTPServer,"SelectFTPServer" },
+	{ SCRSDK::CrDeviceProperty_SelectFTPServerID,"SelectFTPServerID" },
+	{ SCRSDK::CrDeviceProperty_SelectFinder,"SelectFinder" },
+	{ SCRSDK::CrDeviceProperty_SelectIPTCMetadata,"SelectIPTCMetadata" },
+	{ SCRSDK::CrDeviceProperty_SelectUserBaseLookToEdit,"SelectUserBaseLookToEdit" },
+	{ SCRSDK::CrDeviceProperty_SelectUserBaseLookToSetInPPLUT,"SelectUserBaseLookToSetInPPLUT" },
+	{ SCRSDK::CrDeviceProperty_SensorCleaningEnableStatus,"SensorCleaningEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_SetCopyright,"SetCopyright" },
+	{ SCRSDK::CrDeviceProperty_SetPhotographer,"SetPhotographer" },
+	{ SCRSDK::CrDeviceProperty_SetPresetPTZFBinaryVersion,"SetPresetPTZFBinaryVersion" },
+	{ SCRSDK::CrDeviceProperty_ShootingEnableSettingLicense,"ShootingEnableSettingLicense" },
+	{ SCRSDK::CrDeviceProperty_ShootingSelfTimerStatus,"ShootingSelfTimerStatus" },
+	{ SCRSDK::CrDeviceProperty_ShootingTimingPreNotificationMode,"ShootingTimingPreNotificationMode" },
+	{ SCRSDK::CrDeviceProperty_ShutterAngle,"ShutterAngle" },
+	{ SCRSDK::CrDeviceProperty_ShutterECSFrequency,"ShutterECSFrequency" },
+	{ SCRSDK::CrDeviceProperty_ShutterECSNumber,"ShutterECSNumber" },
+	{ SCRSDK::CrDeviceProperty_ShutterECSNumberStep,"ShutterECSNumberStep" },
+	{ SCRSDK::CrDeviceProperty_ShutterECSSetting,"ShutterECSSetting" },
+	{ SCRSDK::CrDeviceProperty_ShutterMode,"ShutterMode" },
+	{ SCRSDK::CrDeviceProperty_ShutterModeSetting,"ShutterModeSetting" },
+	{ SCRSDK::CrDeviceProperty_ShutterModeStatus,"ShutterModeStatus" },
+	{ SCRSDK::CrDeviceProperty_ShutterReleaseTimeLagControl,"ShutterReleaseTimeLagControl" },
+	{ SCRSDK::CrDeviceProperty_ShutterSelectMode,"ShutterSelectMode" },
+	{ SCRSDK::CrDeviceProperty_ShutterSetting,"ShutterSetting" },
+	{ SCRSDK::CrDeviceProperty_ShutterSlow,"ShutterSlow" },
+	{ SCRSDK::CrDeviceProperty_ShutterSlowFrames,"ShutterSlowFrames" },
+	{ SCRSDK::CrDeviceProperty_ShutterSpeed,"ShutterSpeed" },
+	{ SCRSDK::CrDeviceProperty_ShutterSpeedCurrentValue,"ShutterSpeedCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_ShutterSpeedValue,"ShutterSpeedValue" },
+	{ SCRSDK::CrDeviceProperty_ShutterType,"ShutterType" },
+	{ SCRSDK::CrDeviceProperty_SilentMode,"SilentMode" },
+	{ SCRSDK::CrDeviceProperty_SilentModeApertureDriveInAF,"SilentModeApertureDriveInAF" },
+	{ SCRSDK::CrDeviceProperty_SilentModeAutoPixelMapping,"SilentModeAutoPixelMapping" },
+	{ SCRSDK::CrDeviceProperty_SilentModeShutterWhenPowerOff,"SilentModeShutterWhenPowerOff" },
+	{ SCRSDK::CrDeviceProperty_SimulRecSetting,"SimulRecSetting" },
+	{ SCRSDK::CrDeviceProperty_SimulRecSettingMovieRecButton,"SimulRecSettingMovieRecButton" },
+	{ SCRSDK::CrDeviceProperty_SnapshotInfo,"SnapshotInfo" },
+	{ SCRSDK::CrDeviceProperty_SoftSkinEffect,"SoftSkinEffect" },
+	{ SCRSDK::CrDeviceProperty_SoftwareVersion,"SoftwareVersion" },
+	{ SCRSDK::CrDeviceProperty_StillImageQuality,"StillImageQuality" },
+	{ SCRSDK::CrDeviceProperty_StillImageStoreDestination,"StillImageStoreDestination" },
+	{ SCRSDK::CrDeviceProperty_Still_Image_Trans_Size,"Still_Image_Trans_Size" },
+	{ SCRSDK::CrDeviceProperty_StreamCipherType,"StreamCipherType" },
+	{ SCRSDK::CrDeviceProperty_StreamDisplayName,"StreamDisplayName" },
+	{ SCRSDK::CrDeviceProperty_StreamLatency,"StreamLatency" },
+	{ SCRSDK::CrDeviceProperty_StreamModeSetting,"StreamModeSetting" },
+	{ SCRSDK::CrDeviceProperty_StreamSettingListOperationStatus,"StreamSettingListOperationStatus" },
+	{ SCRSDK::CrDeviceProperty_StreamStatus,"StreamStatus" },
+	{ SCRSDK::CrDeviceProperty_StreamTTL,"StreamTTL" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAF,"SubjectRecognitionAF" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalBirdDetectionParts,"SubjectRecognitionAnimalBirdDetectionParts" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalBirdPriority,"SubjectRecognitionAnimalBirdPriority" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalDetectionParts,"SubjectRecognitionAnimalDetectionParts" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalDetectionSensitivity,"SubjectRecognitionAnimalDetectionSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalTrackingSensitivity,"SubjectRecognitionAnimalTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionAnimalTrackingSubjectShiftRange,"SubjectRecognitionAnimalTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionBirdDetectionParts,"SubjectRecognitionBirdDetectionParts" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionBirdDetectionSensitivity,"SubjectRecognitionBirdDetectionSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionBirdTrackingSensitivity,"SubjectRecognitionBirdTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionBirdTrackingSubjectShiftRange,"SubjectRecognitionBirdTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionCarTrainDetectionSensitivity,"SubjectRecognitionCarTrainDetectionSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionCarTrainTrackingSensitivity,"SubjectRecognitionCarTrainTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionCarTrainTrackingSubjectShiftRange,"SubjectRecognitionCarTrainTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionInAF,"SubjectRecognitionInAF" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionInsectDetectionSensitivity,"SubjectRecognitionInsectDetectionSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionInsectTrackingSensitivity,"SubjectRecognitionInsectTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionInsectTrackingSubjectShiftRange,"SubjectRecognitionInsectTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionPersonTrackingSubjectShiftRange,"SubjectRecognitionPersonTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionPlaneDetectionSensitivity,"SubjectRecognitionPlaneDetectionSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionPlaneTrackingSensitivity,"SubjectRecognitionPlaneTrackingSensitivity" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionPlaneTrackingSubjectShiftRange,"SubjectRecognitionPlaneTrackingSubjectShiftRange" },
+	{ SCRSDK::CrDeviceProperty_SubjectRecognitionPriorityOnRegisteredFace,"SubjectRecognitionPriorityOnRegisteredFace" },
+	{ SCRSDK::CrDeviceProperty_SynchroterminalForcedOutput,"SynchroterminalForcedOutput" },
+	{ SCRSDK::CrDeviceProperty_SystemErrorCautionStatus,"SystemErrorCautionStatus" },
+	{ SCRSDK::CrDeviceProperty_TCUBDisplaySetting,"TCUBDisplaySetting" },
+	{ SCRSDK::CrDeviceProperty_TNumber,"TNumber" },
+	{ SCRSDK::CrDeviceProperty_TallyLampControlGreen,"TallyLampControlGreen" },
+	{ SCRSDK::CrDeviceProperty_TallyLampControlRed,"TallyLampControlRed" },
+	{ SCRSDK::CrDeviceProperty_TallyLampControlYellow,"TallyLampControlYellow" },
+	{ SCRSDK::CrDeviceProperty_TargetStreamingDestinationSelect,"TargetStreamingDestinationSelect" },
+	{ SCRSDK::CrDeviceProperty_TeleWideLeverValueCapability,"TeleWideLeverValueCapability" },
+	{ SCRSDK::CrDeviceProperty_TiltLimitMode,"TiltLimitMode" },
+	{ SCRSDK::CrDeviceProperty_TiltLimitRangeMaximum,"TiltLimitRangeMaximum" },
+	{ SCRSDK::CrDeviceProperty_TiltLimitRangeMinimum,"TiltLimitRangeMinimum" },
+	{ SCRSDK::CrDeviceProperty_TiltPositionCurrentValue,"TiltPositionCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_TiltPositionStatus,"TiltPositionStatus" },
+	{ SCRSDK::CrDeviceProperty_TimeCodeFormat,"TimeCodeFormat" },
+	{ SCRSDK::CrDeviceProperty_TimeCodeMake,"TimeCodeMake" },
+	{ SCRSDK::CrDeviceProperty_TimeCodePreset,"TimeCodePreset" },
+	{ SCRSDK::CrDeviceProperty_TimeCodePresetResetEnableStatus,"TimeCodePresetResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_TimeCodeRun,"TimeCodeRun" },
+	{ SCRSDK::CrDeviceProperty_TimeShiftPreShootingTimeSetting,"TimeShiftPreShootingTimeSetting" },
+	{ SCRSDK::CrDeviceProperty_TimeShiftShooting,"TimeShiftShooting" },
+	{ SCRSDK::CrDeviceProperty_TimeShiftShootingStatus,"TimeShiftShootingStatus" },
+	{ SCRSDK::CrDeviceProperty_TimeShiftTriggerSetting,"TimeShiftTriggerSetting" },
+	{ SCRSDK::CrDeviceProperty_TopOfTheGroupShootingMarkSetting,"TopOfTheGroupShootingMarkSetting" },
+	{ SCRSDK::CrDeviceProperty_TotalBatteryLevel,"TotalBatteryLevel" },
+	{ SCRSDK::CrDeviceProperty_TotalBatteryRemain,"TotalBatteryRemain" },
+	{ SCRSDK::CrDeviceProperty_TouchFunctionInMF,"TouchFunctionInMF" },
+	{ SCRSDK::CrDeviceProperty_TouchOperation,"TouchOperation" },
+	{ SCRSDK::CrDeviceProperty_TrackingOnAndAFOnEnableStatus,"TrackingOnAndAFOnEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_USBPowerSupply,"USBPowerSupply" },
+	{ SCRSDK::CrDeviceProperty_Undefined,"Undefined" },
+	{ SCRSDK::CrDeviceProperty_UpdateBodyStatus,"UpdateBodyStatus" },
+	{ SCRSDK::CrDeviceProperty_UploadDatasetVersion,"UploadDatasetVersion" },
+	{ SCRSDK::CrDeviceProperty_UserBaseLookAELevelOffset,"UserBaseLookAELevelOffset" },
+	{ SCRSDK::CrDeviceProperty_UserBaseLookInput,"UserBaseLookInput" },
+	{ SCRSDK::CrDeviceProperty_UserBaseLookOutput,"UserBaseLookOutput" },
+	{ SCRSDK::CrDeviceProperty_UserBitPreset,"UserBitPreset" },
+	{ SCRSDK::CrDeviceProperty_UserBitPresetResetEnableStatus,"UserBitPresetResetEnableStatus" },
+	{ SCRSDK::CrDeviceProperty_UserBitTimeRec,"UserBitTimeRec" },
+	{ SCRSDK::CrDeviceProperty_ValidRecordingVideoFormat,"ValidRecordingVideoFormat" },
+	{ SCRSDK::CrDeviceProperty_VideoRecordingFormatBitrateSetting,"VideoRecordingFormatBitrateSetting" },
+	{ SCRSDK::CrDeviceProperty_VideoRecordingFormatQuality,"VideoRecordingFormatQuality" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamAdaptiveRateControl,"VideoStreamAdaptiveRateControl" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamBitRateCompressionMode,"VideoStreamBitRateCompressionMode" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamBitRateVBRMode,"VideoStreamBitRateVBRMode" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamCodec,"VideoStreamCodec" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamMaxBitRate,"VideoStreamMaxBitRate" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamMovieRecPermission,"VideoStreamMovieRecPermission" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamResolution,"VideoStreamResolution" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamResolutionMethod,"VideoStreamResolutionMethod" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamSelect,"VideoStreamSelect" },
+	{ SCRSDK::CrDeviceProperty_VideoStreamSettingVersion,"VideoStreamSettingVersion" },
+	{ SCRSDK::CrDeviceProperty_WakeOnLAN,"WakeOnLAN" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalance,"WhiteBalance" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceBGain,"WhiteBalanceBGain" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceModeSetting,"WhiteBalanceModeSetting" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceOffsetColorTemp,"WhiteBalanceOffsetColorTemp" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceOffsetColorTempATW,"WhiteBalanceOffsetColorTempATW" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceOffsetSetting,"WhiteBalanceOffsetSetting" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceOffsetTintATW,"WhiteBalanceOffsetTintATW" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalancePresetColorTemperature,"WhiteBalancePresetColorTemperature" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceRGain,"WhiteBalanceRGain" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceSwitch,"WhiteBalanceSwitch" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceTint,"WhiteBalanceTint" },
+	{ SCRSDK::CrDeviceProperty_WhiteBalanceTintStep,"WhiteBalanceTintStep" },
+	{ SCRSDK::CrDeviceProperty_WindNoiseReduct,"WindNoiseReduct" },
+	{ SCRSDK::CrDeviceProperty_WirelessFlash,"WirelessFlash" },
+	{ SCRSDK::CrDeviceProperty_WriteCopyrightInfo,"WriteCopyrightInfo" },
+	{ SCRSDK::CrDeviceProperty_ZoomAndFocusPosition_Load,"ZoomAndFocusPosition_Load" },
+	{ SCRSDK::CrDeviceProperty_ZoomAndFocusPosition_Save,"ZoomAndFocusPosition_Save" },
+	{ SCRSDK::CrDeviceProperty_ZoomAndFocusPresetDataVersion,"ZoomAndFocusPresetDataVersion" },
+	{ SCRSDK::CrDeviceProperty_ZoomAndFocusPresetZoomOnly_Set,"ZoomAndFocusPresetZoomOnly_Set" },
+	{ SCRSDK::CrDeviceProperty_ZoomDistance,"ZoomDistance" },
+	{ SCRSDK::CrDeviceProperty_ZoomDistanceUnitSetting,"ZoomDistanceUnitSetting" },
+	{ SCRSDK::CrDeviceProperty_ZoomDrivingStatus,"ZoomDrivingStatus" },
+	{ SCRSDK::CrDeviceProperty_ZoomOperationWithInt16,"ZoomOperationWithInt16" },
+	{ SCRSDK::CrDeviceProperty_ZoomPositionCurrentValue,"ZoomPositionCurrentValue" },
+	{ SCRSDK::CrDeviceProperty_ZoomPositionSetting,"ZoomPositionSetting" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Bar_Information,"Zoom_Bar_Information" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Operation,"Zoom_Operation" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Operation_Status,"Zoom_Operation_Status" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Scale,"Zoom_Scale" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Setting,"Zoom_Setting" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Speed_Range,"Zoom_Speed_Range" },
+	{ SCRSDK::CrDeviceProperty_Zoom_Type_Status,"Zoom_Type_Status" },
+	{ SCRSDK::CrDeviceProperty_reserved10,"reserved10" },
+	{ SCRSDK::CrDeviceProperty_reserved11,"reserved11" },
+	{ SCRSDK::CrDeviceProperty_reserved12,"reserved12" },
+	{ SCRSDK::CrDeviceProperty_reserved13,"reserved13" },
+	{ SCRSDK::CrDeviceProperty_reserved14,"reserved14" },
+	{ SCRSDK::CrDeviceProperty_reserved15,"reserved15" },
+	{ SCRSDK::CrDeviceProperty_reserved16,"reserved16" },
+	{ SCRSDK::CrDeviceProperty_reserved17,"reserved17" },
+	{ SCRSDK::CrDeviceProperty_reserved18,"reserved18" },
+	{ SCRSDK::CrDeviceProperty_reserved19,"reserved19" },
+	{ SCRSDK::CrDeviceProperty_reserved20,"reserved20" },
+	{ SCRSDK::CrDeviceProperty_reserved22,"reserved22" },
+	{ SCRSDK::CrDeviceProperty_reserved26,"reserved26" },
+	{ SCRSDK::CrDeviceProperty_reserved27,"reserved27" },
+	{ SCRSDK::CrDeviceProperty_reserved32,"reserved32" },
+	{ SCRSDK::CrDeviceProperty_reserved35,"reserved35" },
+	{ SCRSDK::CrDeviceProperty_reserved36,"reserved36" },
+	{ SCRSDK::CrDeviceProperty_reserved37,"reserved37" },
+	{ SCRSDK::CrDeviceProperty_reserved38,"reserved38" },
+	{ SCRSDK::CrDeviceProperty_reserved39,"reserved39" },
+	{ SCRSDK::CrDeviceProperty_reserved4,"reserved4" },
+	{ SCRSDK::CrDeviceProperty_reserved40,"reserved40" },
+	{ SCRSDK::CrDeviceProperty_reserved41,"reserved41" },
+	{ SCRSDK::CrDeviceProperty_reserved42,"reserved42" },
+	{ SCRSDK::CrDeviceProperty_reserved43,"reserved43" },
+	{ SCRSDK::CrDeviceProperty_reserved44,"reserved44" },
+	{ SCRSDK::CrDeviceProperty_reserved45,"reserved45" },
+	{ SCRSDK::CrDeviceProperty_reserved46,"reserved46" },
+	{ SCRSDK::CrDeviceProperty_reserved47,"reserved47" },
+	{ SCRSDK::CrDeviceProperty_reserved56,"reserved56" },
+	{ SCRSDK::CrDeviceProperty_reserved6,"reserved6" },
+	{ SCRSDK::CrDeviceProperty_reserved7,"reserved7" },
+	{ SCRSDK::CrDeviceProperty_reserved8,"reserved8" },
+	{ SCRSDK::CrDeviceProperty_reserved9,"reserved9" },
+};
+static_assert(isSortedByName(map_CrDevicePropertyName), "map_CrDevicePropertyName must be sorted by name");
+static_assert(isSameTable(map_CrDeviceProperty, map_CrDevicePropertyName), "map_CrDevicePropertyName must hold the pairs of map_CrDeviceProperty");
+
+std::string CrDevicePropertyString(SCRSDK::CrDevicePropertyCode code)
+{
+	return getMapString(makeTable(map_CrDeviceProperty), (CrInt32)code);
+}
+
+SCRSDK::CrDevicePropertyCode CrDevicePropertyCode(std::string_view name)
+{
+	return (SCRSDK::CrDevicePropertyCode)getMapCode(makeTable(map_CrDevicePropertyName), name);
+}
+
+static constexpr CrCodeName map_CrError[] =
+{
+//	{ SCRSDK::CrError_\1,"\1" },
+	{ SCRSDK::CrError_None,"None" },
+	{ SCRSDK::CrError_Generic_Unknown,"Generic_Unknown" },
+	{ SCRSDK::CrError_Generic_Notimpl,"Generic_Notimpl" },
+	{ SCRSDK::CrError_Generic_Abort,"Generic_Abort" },
+	{ SCRSDK::CrError_Generic_NotSupported,"Generic_NotSupported" },
+	{ SCRSDK::CrError_Generic_SeriousErrorNotSupported,"Generic_SeriousErrorNotSupported" },
+	{ SCRSDK::CrError_Generic_InvalidHandle,"Generic_InvalidHandle" },
+	{ SCRSDK::CrError_Generic_InvalidParameter,"Generic_InvalidParameter" },
+	{ SCRSDK::CrError_File_Unknown,"File_Unknown" },
+	{ SCRSDK::CrError_File_IllegalOperation,"File_IllegalOperation" },
+	{ SCRSDK::CrError_File_IllegalParameter,"File_IllegalParameter" },
+	{ SCRSDK::CrError_File_EOF,"File_EOF" },
+	{ SCRSDK::CrError_File_OutOfRange,"File_OutOfRange" },
+	{ SCRSDK::CrError_File_NotFound,"File_NotFound" },
+	{ SCRSDK::CrError_File_DirNotFound,"File_DirNotFound" },
+	{ SCRSDK::CrError_File_AlreadyOpened,"File_AlreadyOpened" },
+	{ SCRSDK::CrError_File_PermissionDenied,"File_PermissionDenied" },
+	{ SCRSDK::CrError_File_StorageFull,"File_StorageFull" },
+	{ SCRSDK::CrError_File_AlreadyExists,"File_AlreadyExists" },
+	{ SCRSDK::CrError_File_TooManyOpenedFiles,"File_TooManyOpenedFiles" },
+	{ SCRSDK::CrError_File_ReadOnly,"File_ReadOnly" },
+	{ SCRSDK::CrError_File_CantOpen,"File_CantOpen" },
+	{ SCRSDK::CrError_File_CantClose,"File_CantClose" },
+	{ SCRSDK::CrError_File_CantDelete,"File_CantDelete" },
+	{ SCRSDK::CrError_File_CantRead,"File_CantRead" },
+	{ SCRSDK::CrError_File_CantWrite,"File_CantWrite" },
+	{ SCRSDK::CrError_File_CantCreateDir,"File_CantCreateDir" },
+	{ SCRSDK::CrError_File_OperationAbortedByUser,"File_OperationAbortedByUser" },
+	{ SCRSDK::CrError_File_UnsupportedOperation,"File_UnsupportedOperation" },
+	{ SCRSDK::CrError_File_NotYetCompleted,"File_NotYetCompleted" },
+	{ SCRSDK::CrError_File_Invalid,"File_Invalid" },
+	{ SCRSDK::CrError_File_StorageNotExist,"File_StorageNotExist" },
+	{ SCRSDK::CrError_File_SharingViolation,"File_SharingViolation" },
+	{ SCRSDK::CrError_File_Rotation,"File_Rotation" },
+	{ SCRSDK::CrError_File_SameNameFull,"File_SameNameFull" },
+	{ SCRSDK::CrError_Connect_Unknown,"Connect_Unknown" },
+	{ SCRSDK::CrError_Connect_Connect,"Connect_Connect" },
+	{ SCRSDK::CrError_Connect_ConnectIP,"Connect_ConnectIP" },
+	{ SCRSDK::CrError_Connect_Release,"Connect_Release" },
+	{ SCRSDK::CrError_Connect_GetProperty,"Connect_GetProperty" },
+	{ SCRSDK::CrError_Connect_SendCommand,"Connect_SendCommand" },
+	{ SCRSDK::CrError_Connect_HandlePlugin,"Connect_HandlePlugin" },
+	{ SCRSDK::CrError_Connect_Disconnected,"Connect_Disconnected" },
+	{ SCRSDK::CrError_Connect_TimeOut,"Connect_TimeOut" },
+	{ SCRSDK::CrError_Reconnect_TimeOut,"Reconnect_TimeOut" },
+	{ SCRSDK::CrError_Connect_FailRejected,"Connect_FailRejected" },
+	{ SCRSDK::CrError_Connect_FailBusy,"Connect_FailBusy" },
+	{ SCRSDK::CrError_Connect_FailUnspecified,"Connect_FailUnspecified" },
+	{ SCRSDK::CrError_Connect_Cancel,"Connect_Cancel" },
+	{ SCRSDK::CrError_Reserved1,"Reserved1" },
+	{ SCRSDK::CrError_Reserved2,"Reserved2" },
+	{ SCRSDK::CrError_Connect_SessionAlreadyOpened,"Connect_SessionAlreadyOpened" },
+	{ SCRSDK::CrError_Connect_ContentsTransfer_NotSupported,"Connect_ContentsTransfer_NotSupported" },
+	{ SCRSDK::CrError_Connect_SSH_NotSupported,"Connect_SSH_NotSupported" },
+	{ SCRSDK::CrError_Connect_SSH_InvalidParameter,"Connect_SSH_InvalidParameter" },
+	{ SCRSDK::CrError_Connect_SSH_ServerConnectFailed,"Connect_SSH_ServerConnectFailed" },
+	{ SCRSDK::CrError_Connect_SSH_ServerAuthenticationFailed,"Connect_SSH_ServerAuthenticationFailed" },
+	{ SCRSDK::CrError_Connect_SSH_UserAuthenticationFailed,"Connect_SSH_UserAuthenticationFailed" },
+	{ SCRSDK::CrError_Connect_SSH_PortForwardFailed,"Connect_SSH_PortForwardFailed" },
+	{ SCRSDK::CrError_Connect_SSH_GetFingerprintFailed,"Connect_SSH_GetFingerprintFailed" },
+	{ SCRSDK::CrError_Connect_RemoteTransfer_NotSupported,"Connect_RemoteTransfer_NotSupported" },
+	{ SCRSDK::CrError_Memory_Unknown,"Memory_Unknown" },
+	{ SCRSDK::CrError_Memory_OutOfMemory,"Memory_OutOfMemory" },
+	{ SCRSDK::CrError_Memory_InvalidPointer,"Memory_InvalidPointer" },
+	{ SCRSDK::CrError_Memory_Insufficient,"Memory_Insufficient" },
+	{ SCRSDK::CrError_Api_Unknown,"Api_Unknown" },
+	{ SCRSDK::CrError_Api_Insufficient,"Api_Insufficient" },
+	{ SCRSDK::CrError_Api_InvalidCalled,"Api_InvalidCalled" },
+	{ SCRSDK::CrError_Api_NoApplicableInformation,"Api_NoApplicableInformation" },
+	{ SCRSDK::CrError_Api_OutOfModelList,"Api_OutOfModelList" },
+	{ SCRSDK::CrError_Api_NotSupportModelOfUSB,"Api_NotSupportModelOfUSB" },
+	{ SCRSDK::CrError_Api_NotSupportModelOfEthernet,"Api_NotSupportModelOfEthernet" },
+	{ SCRSDK::CrError_Api_InvalidSerialNumber,"Api_InvalidSerialNumber" },
+	{ SCRSDK::CrError_Api_InvalidIpAddress,"Api_InvalidIpAddress" },
+	{ SCRSDK::CrError_Api_InvalidMacAddress,"Api_InvalidMacAddress" },
+	{ SCRSDK::CrError_Api_PasswordLengthOverMax,"Api_PasswordLengthOverMax" },
+	{ SCRSDK::CrError_Api_PasswordIncludesInvalidCharacter,"Api_PasswordIncludesInvalidCharacter" },
+	{ SCRSDK::CrError_Polling_Unknown,"Polling_Unknown" },
+	{ SCRSDK::CrError_Polling_InvalidVal_Intervals,"Polling_InvalidVal_Intervals" },
+	{ SCRSDK::CrError_Adaptor_Unknown,"Adaptor_Unknown" },
+	{ SCRSDK::CrError_Adaptor_InvalidProperty,"Adaptor_InvalidProperty" },
+	{ SCRSDK::CrError_Adaptor_GetInfo,"Adaptor_GetInfo" },
+	{ SCRSDK::CrError_Adaptor_Create,"Adaptor_Create" },
+	{ SCRSDK::CrError_Adaptor_SendCommand,"Adaptor_SendCommand" },
+	{ SCRSDK::CrError_Adaptor_HandlePlugin,"Adaptor_HandlePlugin" },
+	{ SCRSDK::CrError_Adaptor_CreateDevice,"Adaptor_CreateDevice" },
+	{ SCRSDK::CrError_Adaptor_EnumDevice,"Adaptor_EnumDevice" },
+	{ SCRSDK::CrError_Adaptor_Reset,"Adaptor_Reset" },
+	{ SCRSDK::CrError_Adaptor_Read,"Adaptor_Read" },
+	{ SCRSDK::CrError_Adaptor_Phase,"Adaptor_Phase" },
+	{ SCRSDK::CrError_Adaptor_DataToWiaItem,"Adaptor_DataToWiaItem" },
+	{ SCRSDK::CrError_Adaptor_DeviceBusy,"Adaptor_DeviceBusy" },
+	{ SCRSDK::CrError_Adaptor_Escape,"Adaptor_Escape" },
+	{ SCRSDK::CrError_Adaptor_InvalidParameter,"Adaptor_InvalidParameter" },
+	{ SCRSDK::CrError_Adaptor_FeatureVersionInvalidValue,"Adaptor_FeatureVersionInvalidValue" },
+	{ SCRSDK::CrError_Adaptor_TemporaryStorageFull,"Adaptor_TemporaryStorageFull" },
+	{ SCRSDK::CrError_Adaptor_CameraStatusError,"Adaptor_CameraStatusError" },
+	{ SCRSDK::CrError_Device_Unknown,"Device_Unknown" },
+	{ SCRSDK::CrError_Contents_Unknown,"Contents_Unknown" },
+	{ SCRSDK::CrError_Contents_Reserved1,"Contents_Reserved1" },
+	{ SCRSDK::CrError_Contents_InvalidHandle,"Contents_InvalidHandle" },
+	{ SCRSDK::CrError_Contents_DateFolderList_NotRetrieved,"Contents_DateFolderList_NotRetrieved" },
+	{ SCRSDK::CrError_Contents_ContentsList_NotRetrieved,"Contents_ContentsList_NotRetrieved" },
+	{ SCRSDK::CrError_Contents_Transfer_Unsuccess,"Contents_Transfer_Unsuccess" },
+	{ SCRSDK::CrError_Contents_Transfer_Cancel,"Contents_Transfer_Cancel" },
+	{ SCRSDK::CrError_Contents_RejectRequest,"Contents_RejectRequest" },
+	{ SCRSDK::CrError_RemoteTransfer_Unknown,"RemoteTransfer_Unknown" },
+	{ SCRSDK::CrError_RemoteTransfer_VideoFileNotSupported,"RemoteTransfer_VideoFileNotSupported" },
+	{ SCRSDK::CrError_RemoteTransfer_ContentNotFound,"RemoteTransfer_ContentNotFound" },
+	{ SCRSDK::CrError_RemoteTransfer_GetContentsDataDisable,"RemoteTransfer_GetContentsDataDisable" },
+	{ SCRSDK::CrError_RemoteTransfer_StatusError,"RemoteTransfer_StatusError" },
+	{ SCRSDK::CrError_RemoteTransfer_GetContentsInfoListProcessing,"RemoteTransfer_GetContentsInfoListProcessing" },
+	{ SCRSDK::CrError_Monitoring_Unknown,"Monitoring_Unknown" },
+	{ SCRSDK::CrError_Monitoring_InvalidCalled_AlreadyStart,"Monitoring_InvalidCalled_AlreadyStart" },
+	{ SCRSDK::CrError_Monitoring_InvalidCalled_AlreadyStop,"Monitoring_InvalidCalled_AlreadyStop" },
+	{ SCRSDK::CrError_Monitoring_InvalidCalled_LiveViewEnabled,"Monitoring_InvalidCalled_LiveViewEnabled" },
+	{ SCRSDK::CrError_Monitoring_InvalidCalled_PlaybackEnabled,"Monitoring_InvalidCalled_PlaybackEnabled" },
+	{ SCRSDK::CrError_Playback_Unknown,"Playback_Unknown" },
+	{ SCRSDK::CrError_Playback_InvalidCalled_LiveViewEnabled,"Playback_InvalidCalled_LiveViewEnabled" },
+	{ SCRSDK::CrError_Playback_InvalidCalled_MonitoringEnabled,"Playback_InvalidCalled_MonitoringEnabled" },
+	{ SCRSDK::CrWarning_Unknown,"Unknown" },
+	{ SCRSDK::CrWarning_Connect_Reconnected,"Connect_Reconnected" },
+	{ SCRSDK::CrWarning_Connect_Reconnecting,"Connect_Reconnecting" },
+	{ SCRSDK::CrWarning_File_StorageFull,"File_StorageFull" },
+	{ SCRSDK::CrWarning_SetFileName_Failed,"SetFileName_Failed" },
+	{ SCRSDK::CrWarning_GetImage_Failed,"GetImage_Failed" },
+	{ SCRSDK::CrWarning_FailedToSetCWB,"FailedToSetCWB" },
+	{ SCRSDK::CrWarning_NetworkErrorOccurred,"NetworkErrorOccurred" },
+	{ SCRSDK::CrWarning_NetworkErrorRecovered,"NetworkErrorRecovered" },
+	{ SCRSDK::CrWarning_Format_Failed,"Format_Failed" },
+	{ SCRSDK::CrWarning_Format_Invalid,"Format_Invalid" },
+	{ SCRSDK::CrWarning_Format_Complete,"Format_Complete" },
 	{ SCRSDK::CrWarning_FTPTransferSetting_Read_Result_Invalid,"FTPTransferSetting_Read_Result_Invalid" },
 	{ SCRSDK::CrWarning_FTPTransferSetting_Read_Result_OK,"FTPTransferSetting_Read_Result_OK" },
 	{ SCRSDK::CrWarning_FTPTransferSetting_Read_Result_NG,"FTPTransferSetting_Read_Result_NG" },
@@ -1222,13 +2149,14 @@ const std::unordered_map<CrInt32, std::string> map_CrError
 	{ SCRSDK::CrWarning_DisplayListChanged_Reserved30,"DisplayListChanged_Reserved30" },
 	{ SCRSDK::CrWarning_DisplayListChanged_Reserved31,"DisplayListChanged_Reserved31" },
 };
+static_assert(isSortedByCode(map_CrError), "map_CrError must be sorted by code");
 
 std::string CrErrorString(SCRSDK::CrError error)
 {
-	return getMapString(&map_CrError, (CrInt32)error);
+	return getMapString(makeTable(map_CrError), (CrInt32)error);
 }
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExt_AFStatusParam
+static constexpr CrCodeName map_CrWarningExt_AFStatusParam[] =
 {
 	{ SCRSDK::CrWarningExt_AFStatusParam_Unlocked,"Unlocked" },
 	{ SCRSDK::CrWarningExt_AFStatusParam_Focused_AF_S,"Focused_AF_S" },
@@ -1239,16 +2167,18 @@ const std::unordered_map<CrInt32, std::string> map_CrWarningExt_AFStatusParam
 	{ SCRSDK::CrWarningExt_AFStatusParam_Unpause,"Unpause" },
 	{ SCRSDK::CrWarningExt_AFStatusParam_Pause,"Pause" },
 };
+static_assert(isSortedByCode(map_CrWarningExt_AFStatusParam), "map_CrWarningExt_AFStatusParam must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrSdkApi
+static constexpr CrCodeName map_CrSdkApi[] =
 {
 	{ SCRSDK::CrSdkApi_Unknown,"Unknown" },
 	{ SCRSDK::CrSdkApi_Invalid,"Invalid" },
 	{ SCRSDK::CrSdkApi_SetDeviceProperty,"SetDeviceProperty" },
 	{ SCRSDK::CrSdkApi_SendCommand,"SendCommand" },
 };
+static_assert(isSortedByCode(map_CrSdkApi), "map_CrSdkApi must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExt_OperationResultsParam
+static constexpr CrCodeName map_CrWarningExt_OperationResultsParam[] =
 {
 	{ SCRSDK::CrWarningExt_OperationResultsParam_Invalid,"Invalid" },
 	{ SCRSDK::CrWarningExt_OperationResultsParam_OK,"OK" },
@@ -1265,16 +2195,18 @@ const std::unordered_map<CrInt32, std::string> map_CrWarningExt_OperationResults
 	{ SCRSDK::CrWarningExt_OperationResultsParam_TintOutOfRangeError,"TintOutOfRangeError" },
 	{ SCRSDK::CrWarningExt_OperationResultsParam_PoorWhiteAreaError,"PoorWhiteAreaError" },
 };
+static_assert(isSortedByCode(map_CrWarningExt_OperationResultsParam), "map_CrWarningExt_OperationResultsParam must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_ControlPTZFResult
+static constexpr CrCodeName map_CrWarningExtParam_ControlPTZFResult[] =
 {
 	{ SCRSDK::CrWarningExtParam_ControlPTZFResult_Invalid,"Invalid" },
 	{ SCRSDK::CrWarningExtParam_ControlPTZFResult_OK,"OK" },
 	{ SCRSDK::CrWarningExtParam_ControlPTZFResult_NG,"NG" },
 	{ SCRSDK::CrWarningExtParam_ControlPTZFResult_Canceled,"Canceled" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_ControlPTZFResult), "map_CrWarningExtParam_ControlPTZFResult must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrPTZFControlType
+static constexpr CrCodeName map_CrPTZFControlType[] =
 {
 	{ SCRSDK::CrPTZFControlType_Absolute,"Absolute" },
 	{ SCRSDK::CrPTZFControlType_Relative,"Relative" },
@@ -1283,16 +2215,18 @@ const std::unordered_map<CrInt32, std::string> map_CrPTZFControlType
 	{ SCRSDK::CrPTZFControlType_Reset,"Reset" },
 	{ SCRSDK::CrPTZFControlType_Cancel,"Cancel" },
 };
+static_assert(isSortedByCode(map_CrPTZFControlType), "map_CrPTZFControlType must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_PresetPTZFEvent
+static constexpr CrCodeName map_CrWarningExtParam_PresetPTZFEvent[] =
 {
 	{ SCRSDK::CrWarningExtParam_PresetPTZFEvent_Invalid,"Invalid" },
 	{ SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveCompleted,"DriveCompleted" },
 	{ SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveInterrupted,"DriveInterrupted" },
 	{ SCRSDK::CrWarningExtParam_PresetPTZFEvent_DriveError,"DriveError" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_PresetPTZFEvent), "map_CrWarningExtParam_PresetPTZFEvent must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_SetStreamSetting
+static constexpr CrCodeName map_CrWarningExtParam_SetStreamSetting[] =
 {
 	{ SCRSDK::CrWarningExtParam_SetStreamSetting_OK,"OK" },
 	{ SCRSDK::CrWarningExtParam_SetStreamSetting_NG,"NG" },
@@ -1305,76 +2239,81 @@ const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_SetStreamSe
 	{ SCRSDK::CrWarningExtParam_SetStreamSetting_InvalidCipherKey,"InvalidCipherKey" },
 	{ SCRSDK::CrWarningExtParam_SetStreamSetting_InvalidMode,"InvalidMode" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_SetStreamSetting), "map_CrWarningExtParam_SetStreamSetting must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_DeleteContent
+static constexpr CrCodeName map_CrWarningExtParam_DeleteContent[] =
 {
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_Invalid, "DeleteContent_Invalid"},
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_OK, "DeleteContent_OK" },
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_StatusError, "DeleteContent_StatusError"},
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_DeviceBusy, "DeleteContent_DeviceBusy"},
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_ContentProtected, "DeleteContent_ContentProtected"},
-	{ SCRSDK::CrWarningExtParam_DeleteContentResult_ContentNotExist, "DeleteContent_ContentNotExist"},
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_Invalid,"DeleteContent_Invalid" },
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_OK,"DeleteContent_OK" },
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_StatusError,"DeleteContent_StatusError" },
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_DeviceBusy,"DeleteContent_DeviceBusy" },
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_ContentProtected,"DeleteContent_ContentProtected" },
+	{ SCRSDK::CrWarningExtParam_DeleteContentResult_ContentNotExist,"DeleteContent_ContentNotExist" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_DeleteContent), "map_CrWarningExtParam_DeleteContent must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_UploadSceneFile
+static constexpr CrCodeName map_CrWarningExtParam_UploadSceneFile[] =
 {
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_Invalid, "UploadSceneFile_Invalid"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_OK, "UploadSceneFile_OK" },
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_NG, "UploadSceneFile_NG"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_InvalidFileName, "UploadSceneFile_InvalidFileName"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_DeviceBusy, "UploadSceneFile_DeviceBusy"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_SomeIsCorrupted, "UploadSceneFile_SomeIsCorrupted"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_InvalidParameter, "UploadSceneFile_InvalidParameter"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_FeatureVersionInvalidValue, "UploadSceneFile_FeatureVersionInvalidValue"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_TemporaryStorageFull, "UploadSceneFile_TemporaryStorageFull"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_File_CantOpen, "UploadSceneFile_File_CantOpen"},
-	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_File_CantRead, "UploadSceneFile_File_CantRead"},
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_InvalidParameter,"UploadSceneFile_InvalidParameter" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_FeatureVersionInvalidValue,"UploadSceneFile_FeatureVersionInvalidValue" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_TemporaryStorageFull,"UploadSceneFile_TemporaryStorageFull" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_File_CantOpen,"UploadSceneFile_File_CantOpen" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_File_CantRead,"UploadSceneFile_File_CantRead" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_Invalid,"UploadSceneFile_Invalid" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_OK,"UploadSceneFile_OK" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_NG,"UploadSceneFile_NG" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_InvalidFileName,"UploadSceneFile_InvalidFileName" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_DeviceBusy,"UploadSceneFile_DeviceBusy" },
+	{ SCRSDK::CrWarningExtParam_UploadSceneFileResult_SomeIsCorrupted,"UploadSceneFile_SomeIsCorrupted" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_UploadSceneFile), "map_CrWarningExtParam_UploadSceneFile must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_DownloadSceneFile
+static constexpr CrCodeName map_CrWarningExtParam_DownloadSceneFile[] =
 {
-	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_Invalid, "DownloadSceneFile_Invalid"},
-	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_DeviceBusy, "DownloadSceneFile_DeviceBusy" },
-	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_NG, "DownloadSceneFile_NG"},
+	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_Invalid,"DownloadSceneFile_Invalid" },
+	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_DeviceBusy,"DownloadSceneFile_DeviceBusy" },
+	{ SCRSDK::CrWarningExtParam_DownloadSceneFileResult_NG,"DownloadSceneFile_NG" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_DownloadSceneFile), "map_CrWarningExtParam_DownloadSceneFile must be sorted by code");
 
-const std::unordered_map<CrInt32, std::string> map_CrWarningExtParam_UploadCustomGridLineFileResult
+static constexpr CrCodeName map_CrWarningExtParam_UploadCustomGridLineFileResult[] =
 {
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_Invalid, "UploadCustomGridLineFile_Invalid"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OK, "UploadCustomGridLineFile_OK" },
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_StatusError, "UploadCustomGridLineFile_StatusError"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_InvalidFileName, "UploadCustomGridLineFile_InvalidFileName"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_MediaError, "UploadCustomGridLineFile_MediaError"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_ReadError, "UploadCustomGridLineFile_ReadError"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OverFileSize, "UploadCustomGridLineFile_OverFileSize"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OverImageSize, "UploadCustomGridLineFile_OverImageSize" },
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_DecodeError, "UploadCustomGridLineFile_DecodeError"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_InvalidParameter, "UploadCustomGridLineFile_InvalidParameter"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_File_CantOpen, "UploadCustomGridLineFile_File_CantOpen"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_File_CantRead, "UploadCustomGridLineFile_File_CantRead"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_DeviceBusy, "UploadCustomGridLineFile_DeviceBusy"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_FeatureVersionInvalidValue, "UploadCustomGridLineFile_FeatureVersionInvalidValue" },
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_TemporaryStorageFull, "UploadCustomGridLineFile_TemporaryStorageFull"},
-	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_CameraStatusError, "UploadCustomGridLineFile_CameraStatusError"},
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_File_CantOpen,"UploadCustomGridLineFile_File_CantOpen" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_File_CantRead,"UploadCustomGridLineFile_File_CantRead" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_DeviceBusy,"UploadCustomGridLineFile_DeviceBusy" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_FeatureVersionInvalidValue,"UploadCustomGridLineFile_FeatureVersionInvalidValue" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_TemporaryStorageFull,"UploadCustomGridLineFile_TemporaryStorageFull" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_CameraStatusError,"UploadCustomGridLineFile_CameraStatusError" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_Invalid,"UploadCustomGridLineFile_Invalid" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OK,"UploadCustomGridLineFile_OK" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_StatusError,"UploadCustomGridLineFile_StatusError" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_InvalidFileName,"UploadCustomGridLineFile_InvalidFileName" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_MediaError,"UploadCustomGridLineFile_MediaError" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_ReadError,"UploadCustomGridLineFile_ReadError" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OverFileSize,"UploadCustomGridLineFile_OverFileSize" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_OverImageSize,"UploadCustomGridLineFile_OverImageSize" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_DecodeError,"UploadCustomGridLineFile_DecodeError" },
+	{ SCRSDK::CrWarningExtParam_UploadCustomGridLineFile_InvalidParameter,"UploadCustomGridLineFile_InvalidParameter" },
 };
+static_assert(isSortedByCode(map_CrWarningExtParam_UploadCustomGridLineFileResult), "map_CrWarningExtParam_UploadCustomGridLineFileResult must be sorted by code");
 
 static std::string func_OperationResults(CrInt32 param1, CrInt32 param2, CrInt32 param3)
 {
 	std::string str = "";
-	str += getMapString(&map_CrSdkApi, param1) + ",";
+	str += getMapString(makeTable(map_CrSdkApi), param1) + ",";
 
-	if(param1 == SCRSDK::CrSdkApi_SetDeviceProperty) str += getMapString(&map_CrDeviceProperty, param2) + ",";
-	else if(param1 == SCRSDK::CrSdkApi_SendCommand)	 str += getMapString(&map_CrCommandId, param2) + ",";
+	if(param1 == SCRSDK::CrSdkApi_SetDeviceProperty) str += getMapString(makeTable(map_CrDeviceProperty), param2) + ",";
+	else if(param1 == SCRSDK::CrSdkApi_SendCommand)	 str += getMapString(makeTable(map_CrCommandId), param2) + ",";
 	else											 str += "unknown,";
 
-	str += getMapString(&map_CrWarningExt_OperationResultsParam, param3);
+	str += getMapString(makeTable(map_CrWarningExt_OperationResultsParam), param3);
 	return str;
 }
 
 static std::string func_DeleteContentResults(CrInt32 param1, CrInt32 param2, CrInt32 param3)
 {
 	std::string str = "";
-	str += getMapString(&map_CrWarningExtParam_DeleteContent, param1) + ",";
+	str += getMapString(makeTable(map_CrWarningExtParam_DeleteContent), param1) + ",";
 
 	str += "ContentsId:" + std::to_string(param2) + ",";
 	str += "SlotNumber:" + std::to_string(param3) + ",";
@@ -1384,53 +2323,59 @@ static std::string func_DeleteContentResults(CrInt32 param1, CrInt32 param2, CrI
 
 struct CrWarningExtString
 {
-	std::string str;
-	std::string (*const func)(CrInt32 param1, CrInt32 param2, CrInt32 param3);
-	const std::unordered_map<CrInt32, std::string>* param1;
-	const std::unordered_map<CrInt32, std::string>* param2;
-	const std::unordered_map<CrInt32, std::string>* param3;
+	std::string_view str;
+	std::string (*func)(CrInt32 param1, CrInt32 param2, CrInt32 param3);
+	CrCodeTable param1;
+	CrCodeTable param2;
+	CrCodeTable param3;
 };
 
-const std::unordered_map<CrInt32, struct CrWarningExtString> map_CrWarningExt
+struct CrWarningExtEntry
 {
-													// str,						func, param1,param2,param3
-	{ SCRSDK::CrWarningExt_Unknown, 				{"Unknown", 				NULL, NULL, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_AFStatus, 				{"AFStatus", 				NULL, &map_CrWarningExt_AFStatusParam, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_OperationResults, 		{"OperationResults", 		func_OperationResults, NULL, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_OperationInvalid, 		{"OperationInvalid", 		func_OperationResults, NULL, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_ControlPTZFResult, 		{"ControlPTZFResult", 		NULL, &map_CrError, &map_CrWarningExtParam_ControlPTZFResult, &map_CrPTZFControlType}},
-	{ SCRSDK::CrWarningExt_PresetPTZFSet,     		{"PresetPTZFSet", 			NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_PresetPTZFClear,			{"PresetPTZFClear", 		NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_PresetPTZFEvent,			{"PresetPTZFEvent", 		NULL, &map_CrWarningExtParam_PresetPTZFEvent, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_RequestTimeZoneSetting, 		{"RequestTimeZoneSetting", 		NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_SetTimeZoneSetting, 		{"SetTimeZoneSetting", 		NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_ExecuteEframing, 		{"ExecuteEframing", 		NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_RequestStreamSettingList, 	{"RequestStreamSettingList",	NULL, &map_CrError, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_SetStreamSettingList, 	{"SetStreamSettingList", 	NULL, &map_CrError, &map_CrWarningExtParam_SetStreamSetting, NULL }},
-	{ SCRSDK::CrWarningExt_DeleteContent,			{"DeleteContentResult",	func_DeleteContentResults, &map_CrWarningExtParam_DeleteContent, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_UploadSceneFile,			{"UploadSceneFileResult",	NULL, &map_CrWarningExtParam_UploadSceneFile, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_DownloadSceneFile,		{"DownloadSceneFileResult",	NULL, &map_CrWarningExtParam_DownloadSceneFile, NULL, NULL }},
-	{ SCRSDK::CrWarningExt_UploadCustomGridLineFile,	{"UploadCustomGridLineFileResult",	NULL, &map_CrWarningExtParam_UploadCustomGridLineFileResult, NULL, NULL }},
+	CrInt32 code;
+	struct CrWarningExtString ext;
+};
 
+static constexpr CrWarningExtEntry map_CrWarningExt[] =
+{
+													// str,						func, param1,param2,param3
+	{ SCRSDK::CrWarningExt_Unknown, 				{"Unknown", NULL, {}, {}, {} }},
+	{ SCRSDK::CrWarningExt_AFStatus, 				{"AFStatus", NULL, makeTable(map_CrWarningExt_AFStatusParam), {}, {} }},
+	{ SCRSDK::CrWarningExt_OperationResults, 		{"OperationResults", func_OperationResults, {}, {}, {} }},
+	{ SCRSDK::CrWarningExt_OperationInvalid, 		{"OperationInvalid", func_OperationResults, {}, {}, {} }},
+	{ SCRSDK::CrWarningExt_ControlPTZFResult, 		{"ControlPTZFResult", NULL, makeTable(map_CrError), makeTable(map_CrWarningExtParam_ControlPTZFResult), makeTable(map_CrPTZFControlType) }},
+	{ SCRSDK::CrWarningExt_PresetPTZFClear,			{"PresetPTZFClear", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_PresetPTZFSet,     		{"PresetPTZFSet", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_PresetPTZFEvent,			{"PresetPTZFEvent", NULL, makeTable(map_CrWarningExtParam_PresetPTZFEvent), {}, {} }},
+	{ SCRSDK::CrWarningExt_RequestTimeZoneSetting, 		{"RequestTimeZoneSetting", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_SetTimeZoneSetting, 		{"SetTimeZoneSetting", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_ExecuteEframing, 		{"ExecuteEframing", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_RequestStreamSettingList, 	{"RequestStreamSettingList", NULL, makeTable(map_CrError), {}, {} }},
+	{ SCRSDK::CrWarningExt_SetStreamSettingList, 	{"SetStreamSettingList", NULL, makeTable(map_CrError), makeTable(map_CrWarningExtParam_SetStreamSetting), {} }},
+	{ SCRSDK::CrWarningExt_DeleteContent,			{"DeleteContentResult", func_DeleteContentResults, makeTable(map_CrWarningExtParam_DeleteContent), {}, {} }},
+	{ SCRSDK::CrWarningExt_UploadSceneFile,			{"UploadSceneFileResult", NULL, makeTable(map_CrWarningExtParam_UploadSceneFile), {}, {} }},
+	{ SCRSDK::CrWarningExt_DownloadSceneFile,		{"DownloadSceneFileResult", NULL, makeTable(map_CrWarningExtParam_DownloadSceneFile), {}, {} }},
+	{ SCRSDK::CrWarningExt_UploadCustomGridLineFile,	{"UploadCustomGridLineFileResult", NULL, makeTable(map_CrWarningExtParam_UploadCustomGridLineFileResult), {}, {} }},
 };
+static_assert(isSortedByCode(map_CrWarningExt), "map_CrWarningExt must be sorted by code");
 
 std::string CrWarningExtString(SCRSDK::CrError error, CrInt32 param1, CrInt32 param2, CrInt32 param3)
 {
-	auto iter = map_CrWarningExt.find(error);
-	if(iter == end(map_CrWarningExt)) {
+	const CrWarningExtEntry* entry = findCode(map_CrWarningExt, std::size(map_CrWarningExt), error);
+	if(entry == NULL) {
 		char tmp[64] = {0};
 		snprintf(tmp, sizeof(tmp), "unknown(0x%x, param1: 0x%x, param2: 0x%x, param3: 0x%x)", error, param1, param2, param3);
 		std::string tmp2(tmp);
 		return tmp2;
 	}
 
-	std::string str = iter->second.str + "(";
-	if(iter->second.func) {
-		str += iter->second.func(param1, param2, param3) + ")";
+	std::string str = std::string(entry->ext.str) + "(";
+	if(entry->ext.func) {
+		str += entry->ext.func(param1, param2, param3) + ")";
 	} else {
-		str += getMapString(iter->second.param1, param1) + ",";
-		str += getMapString(iter->second.param2, param2) + ",";
-		str += getMapString(iter->second.param3, param3) + ")";
+		str += getMapString(entry->ext.param1, param1) + ",";
+		str += getMapString(entry->ext.param2, param2) + ",";
+		str += getMapString(entry->ext.param3, param3) + ")";
 	}
 	return str;
 }
@@ -3,6 +3,8 @@
 #ifndef CRERRORSTRING_H
 #define CRERRORSTRING_H
 
+#include <string>
+#include <string_view>
 #include <CrTypes.h>
 #include <CrError.h>
 #include <CrDeviceProperty.h>
@@ -14,7 +16,7 @@ std::string CrWarningExtString(SCRSDK::CrError error, CrInt32 param1, CrInt32 pa
 std::string CrCommandIdString(SCRSDK::CrCommandId id);
 std::string CrDevicePropertyString(SCRSDK::CrDevicePropertyCode code);
 
-SCRSDK::CrCommandId CrCommandIdCode(std::string name);
-SCRSDK::CrDevicePropertyCode CrDevicePropertyCode(std::string name);
+SCRSDK::CrCommandId CrCommandIdCode(std::string_view name);
+SCRSDK::CrDevicePropertyCode CrDevicePropertyCode(std::string_view name);
 
 #endif // CRERRORSTRING_H
@@ -340,6 +340,9 @@ int RemoteCli_connect(char* inputLine) //<ipaddress> [userid] [pass]
     err = _setDeviceProperty(m_device_handle, SCRSDK::CrDeviceProperty_LiveViewProtocol, 2/*http*/);
     //if(err) goto Error;
 
+    // ptzf_* and controlPTZF drive this device from now on
+    ptzf_attach(m_device_handle);
+
     if(enumCameraObjectInfo) enumCameraObjectInfo->Release();
     return 0;
 Error:
@@ -350,6 +353,7 @@ Error:
 
 int RemoteCli_disconnect(void)
 {
+    ptzf_detach();
     if(m_connected) {
         m_disconnect_req = true;
         std::promise<void> eventPromise;
@@ -405,36 +409,6 @@ Error:
     return err;
 }
 
-int controlPTZF(char* inputLine)
-{
-    SCRSDK::CrError err = 0;
-    std::vector<std::string> args = _split(inputLine, ' ');
-
-    #define SPEED_MAX 50 // 127
-
-    int type = 0;
-    SCRSDK::CrPTZFSetting ptzfSetting;
-    ptzfSetting.pan.exists = 1;
-    ptzfSetting.pan.position = 0;
-    ptzfSetting.pan.speed = SPEED_MAX;
-    ptzfSetting.tilt.exists = 1;
-    ptzfSetting.tilt.position = 0;
-    ptzfSetting.tilt.speed = SPEED_MAX;
-
-    if(args.size() <= 0) return -1;
-    try { type = stoi(args[0]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-
-    if(args.size() >= 2) try { ptzfSetting.pan.position = stoi(args[1]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-    if(args.size() >= 3) try { ptzfSetting.tilt.position = stoi(args[2]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-    if(args.size() >= 4) try { ptzfSetting.pan.speed= stoi(args[3]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-    if(args.size() >= 5) try { ptzfSetting.tilt.speed= stoi(args[4]); } catch(const std::exception&) { GotoError("invalid input", 0); }
-
-    err = SCRSDK::ControlPTZF(m_device_handle, (SCRSDK::CrPTZFControlType)type, &ptzfSetting);
-    if(err) GotoError("", err);
-Error:
-    return err;
-}
-
 int presetPTZFSet(int32_t index)
 {
     SCRSDK::CrError err = 0;
@@ -6,6 +6,8 @@
 #include <memory>
 #define RemoteCli_API __declspec(dllexport)
 
+#include "PtzApi.h"     // ptzf_*, controlPTZF
+
 
 extern "C" __declspec(dllexport)
 int RemoteCli_connect(char* inputLine); //<ipaddress> [userid] [pass]
@@ -19,9 +21,6 @@ int setDeviceProperty(char* code, int64_t data, bool blocking);
 extern "C" __declspec(dllexport)
 int sendCommand(char* inputLine);
 
-extern "C" __declspec(dllexport)
-int controlPTZF(char* type);
-
 extern "C" __declspec(dllexport)
 int presetPTZFSet(int32_t index);
 
@@ -4,6 +4,8 @@ set(__cli_hdr_dir ${CMAKE_CURRENT_SOURCE_DIR}/app)
 ### Enumerate RemoteCli header files ###
 message("[${PROJECT_NAME}] Indexing header files..")
 set(__cli_hdrs
+    ${__cli_hdr_dir}/RemoteCli.h
+    ${__cli_hdr_dir}/../../../cpp/app/PtzApi.h
 )
 
 ## Use cli_srcs in project CMakeLists
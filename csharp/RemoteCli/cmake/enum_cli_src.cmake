@@ -6,6 +6,9 @@ message("[${PROJECT_NAME}] Indexing source files..")
 set(__cli_srcs
     ${__cli_src_dir}/RemoteCli.cpp
     ${__cli_src_dir}/CrDebugString.cpp
+    ${__cli_src_dir}/../../../cpp/app/PtzApi.cpp
+    ${__cli_src_dir}/../../../cpp/app/PtzControl.cpp
+    ${__cli_src_dir}/../../../cpp/app/Metrics.cpp
 )
 
 ## Use cli_srcs in project CMakeLists
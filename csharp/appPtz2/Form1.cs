@@ -109,6 +109,12 @@ namespace appPtz2
         [DllImport(DLLPath, CharSet = CharSet.Ansi)]
         public extern static int controlPTZF([MarshalAs(UnmanagedType.LPStr)] string type);
 
+        [DllImport(DLLPath, CallingConvention = CallingConvention.Cdecl)]
+        public extern static int ptzf_direction(Int32 pan_speed, Int32 tilt_speed);
+
+        [DllImport(DLLPath, CallingConvention = CallingConvention.Cdecl)]
+        public extern static int ptzf_home();
+
         private void panTilt_Click(object sender, EventArgs e)
         {
             int ret = controlPTZF(txtType.Text);
@@ -214,9 +220,7 @@ namespace appPtz2
                 int tilt = -(int)(xy[3] * SPEED_MAX / 32768.0);
                 tilt = Math.Min(SPEED_MAX, Math.Max(-SPEED_MAX, tilt));
 
-                string str2 = $"3 0 0 {pan} {tilt}";  // direction
-                Console.WriteLine(str2);
-                controlPTZF(str2);
+                ptzf_direction(pan, tilt);  // latest wins, 0/0 stops
             } else if(Math.Abs(xyLast[1] - xy[1]) > 5000)
             {
                 int zoom = -xy[1];
@@ -235,7 +239,7 @@ namespace appPtz2
                 {
                     switch(i)
                     {
-                        case 0: controlPTZF("4");                               break;
+                        case 0: ptzf_home();                                    break;
                         case 1: sendCommand("RemoteKeyMenuButton 1 0");         break;
                         case 2: sendCommand("RemoteKeyCancelBackButton 1 0");   break;
                         case 3: sendCommand("RemoteKeySet 1 0");                break;